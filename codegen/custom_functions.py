@@ -186,6 +186,7 @@ const c10::DeviceGuard device_guard(device_or_default(device));"""
     op_key = str(f.func.name)
     op_hook_check = f"""\
 if (C10_UNLIKELY(at_npu::native::env::CheckOpHookEnable())) {{
+    at_npu::native::OpHookStackGuard op_hook_guard;
     at_npu::native::OpHook::GetInstance().PreHook(\"{op_key}\", {args_exprs_str});
     {res_of_op_hook_post_code}{impl_name}({args_exprs_str});
     {return_of_op_hook_post_code}
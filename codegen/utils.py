@@ -473,6 +473,7 @@ const DeviceGuard device_guard(device_or_default(device));"""
                         op_hook_check += f"""\
 if (C10_UNLIKELY(at_npu::native::env::CheckOpHookEnable())) {{
 {auto_lvalue}
+    at_npu::native::OpHookStackGuard op_hook_guard;
     at_npu::native::OpHook::GetInstance().PreHook(\"{op_key}\", {args_exprs_str_for_op_hook});
     if (({force_aclnn} || at_npu::native::env::CheckJitDisable()){tensor_check_str}) {{
         {res_of_op_hook_post_code}{op_api_impl_name}({args_exprs_str_for_op_hook});
@@ -497,6 +498,7 @@ if (({force_aclnn} || at_npu::native::env::CheckJitDisable()){tensor_check_str})
                         op_hook_check += f"""\
 if (C10_UNLIKELY(at_npu::native::env::CheckOpHookEnable())) {{
 {auto_lvalue}
+    at_npu::native::OpHookStackGuard op_hook_guard;
     at_npu::native::OpHook::GetInstance().PreHook(\"{op_key}\", {args_exprs_str_for_op_hook});
     {res_of_op_hook_post_code}{impl_name}({args_exprs_str_for_op_hook});
     {return_of_op_hook_post_code}
@@ -0,0 +1,529 @@
+#include <gtest/gtest.h>
+
+#include <dirent.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "torch_npu/csrc/toolkit/profiler/inc/data_dumper.h"
+
+using namespace torch_npu::toolkit::profiler;
+using torch_npu::profiler::AppendOnlyList;
+using torch_npu::profiler::python_tracer::TraceEvent;
+using torch_npu::profiler::python_tracer::TraceTag;
+
+namespace {
+
+constexpr size_t kTLVHeaderSize = sizeof(uint16_t) + sizeof(uint32_t);
+constexpr size_t kTraceEventSize = 4 * sizeof(uint64_t) + sizeof(uint8_t);
+constexpr size_t kSampleNodeSize = 3 * sizeof(uint64_t) + 3 * sizeof(uint32_t);
+
+// Shape of the synthetic load, overridable from the environment to turn the
+// tests into longer benchmark runs, and the bounds it must meet:
+//   PROFILER_PIPELINE_PRODUCERS     producer threads
+//   PROFILER_PIPELINE_RECORDS       records per producer
+//   PROFILER_PIPELINE_RATE          records per second per producer, 0 for no limit
+//   PROFILER_PIPELINE_CAPACITY      ring buffer capacity, a power of two
+//   PROFILER_PIPELINE_MIN_RATE      records per second the dump must sustain
+//   PROFILER_PIPELINE_MAX_P99_US    p99 latency of a report call
+//   PROFILER_PIPELINE_MAX_DROP_PPM  records dropped per million reported
+// Throughput, latency and drops depend on the machine, so they are only
+// recorded unless their bound is set. Every record must be either dumped or
+// counted as dropped in any case.
+struct PipelineConfig {
+    int64_t producers;
+    int64_t records;
+    int64_t rate;
+    int64_t capacity;
+    int64_t minRate;
+    int64_t maxP99Us;
+    int64_t maxDropPpm;
+};
+
+// A bound that is not checked.
+constexpr int64_t kUnbounded = -1;
+
+struct PipelineResult {
+    uint64_t produced = 0;
+    uint64_t dropped = 0;
+    uint64_t dumped = 0;
+    double seconds = 0;
+    double p99Us = 0;
+};
+
+int64_t envOr(const char *name, int64_t value)
+{
+    const char *env = std::getenv(name);
+    return env != nullptr ? std::strtoll(env, nullptr, 10) : value;
+}
+
+PipelineConfig pipelineConfig()
+{
+    return {envOr("PROFILER_PIPELINE_PRODUCERS", 4), envOr("PROFILER_PIPELINE_RECORDS", 20000),
+            envOr("PROFILER_PIPELINE_RATE", 0), envOr("PROFILER_PIPELINE_CAPACITY", kDefaultRingBuffer * 16),
+            envOr("PROFILER_PIPELINE_MIN_RATE", kUnbounded), envOr("PROFILER_PIPELINE_MAX_P99_US", kUnbounded),
+            envOr("PROFILER_PIPELINE_MAX_DROP_PPM", kUnbounded)};
+}
+
+template<typename T>
+T readFixed(const std::vector<uint8_t> &buf, size_t offset)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        value |= static_cast<uint64_t>(buf[offset + i]) << (i * 8);
+    }
+    return static_cast<T>(value);
+}
+
+class TempDir {
+public:
+    TempDir()
+    {
+        char pattern[] = "/tmp/profiler_pipeline_XXXXXX";
+        if (mkdtemp(pattern) != nullptr) {
+            path_ = pattern;
+        }
+    }
+
+    ~TempDir()
+    {
+        DIR *dir = opendir(path_.c_str());
+        if (dir == nullptr) {
+            return;
+        }
+        for (struct dirent *entry = readdir(dir); entry != nullptr; entry = readdir(dir)) {
+            if (strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0) {
+                unlink((path_ + "/" + entry->d_name).c_str());
+            }
+        }
+        closedir(dir);
+        rmdir(path_.c_str());
+    }
+
+    const std::string &path() const
+    {
+        return path_;
+    }
+
+private:
+    std::string path_;
+};
+
+// Raw bytes of a dump file, with compressed files unpacked segment by segment.
+std::vector<uint8_t> readDumpFile(const std::string &path)
+{
+    std::ifstream file(path, std::ios::binary);
+    std::vector<uint8_t> buf((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (buf.size() < kSegmentFileHeaderSize + kSegmentTrailerSize || readFixed<uint32_t>(buf, 0) != kSegmentFileMagic) {
+        return buf;
+    }
+    const size_t trailer = buf.size() - kSegmentTrailerSize;
+    EXPECT_EQ(readFixed<uint32_t>(buf, trailer + 16), kSegmentIndexMagic) << path;
+    const size_t end = readFixed<uint64_t>(buf, trailer);
+    std::vector<uint8_t> raw;
+    for (size_t offset = kSegmentFileHeaderSize; offset < end;) {
+        const uint32_t compressedSize = readFixed<uint32_t>(buf, offset);
+        const uint32_t rawSize = readFixed<uint32_t>(buf, offset + 4);
+        const uint8_t *payload = buf.data() + offset + kSegmentHeaderSize;
+        const size_t prev = raw.size();
+        raw.resize(prev + rawSize);
+        if (compressedSize == rawSize) {
+            std::copy(payload, payload + rawSize, raw.begin() + prev);
+        } else if (!Lz4DecompressBlock(payload, compressedSize, raw.data() + prev, rawSize)) {
+            ADD_FAILURE() << "corrupted segment at " << offset << " in " << path;
+            return {};
+        }
+        offset += kSegmentHeaderSize + compressedSize;
+    }
+    return raw;
+}
+
+// Records are a pure function of their id, (producer << 32) | sequence, so the
+// decoded output can be compared byte for byte with a fresh encoding. Names,
+// stacks and shapes have fuzzed lengths, and one in a few thousand op ranges
+// is larger than a whole dump batch.
+std::unique_ptr<BaseReportData> makeRecord(uint64_t id)
+{
+    std::mt19937_64 rng(id);
+    switch (rng() % 3) {
+        case 0:
+            return std::make_unique<OpMarkData>(static_cast<int64_t>(rng()), rng() % 4, id, rng(), rng(),
+                                                std::string(rng() % 64, 'm'));
+        case 1:
+            return std::make_unique<MemoryData>(static_cast<int64_t>(id), static_cast<int64_t>(rng()),
+                                                static_cast<int64_t>(rng()), 4, 5, 6, 7, 20,
+                                                static_cast<int8_t>(rng() % 8), 0, 0, rng(), rng());
+        default:
+            break;
+    }
+    auto data = std::make_unique<OpRangeData>(static_cast<int64_t>(rng()), static_cast<int64_t>(rng()),
+                                              static_cast<int64_t>(id), rng(), rng(), rng(), rng(),
+                                              rng() % 2 == 0, "aten::op" + std::to_string(rng() % 1000));
+    for (uint64_t i = rng() % 5; i > 0; --i) {
+        data->input_dtypes.emplace_back("float");
+        data->input_shapes.emplace_back(rng() % 4, static_cast<int64_t>(rng() % 4096));
+    }
+    for (uint64_t i = rng() % 8; i > 0; --i) {
+        data->stack.emplace_back(rng() % 256, 's');
+    }
+    if (rng() % 4096 == 0) {
+        data->stack.emplace_back(kBatchMaxLen, 'x');
+    }
+    return data;
+}
+
+uint16_t expectedType(const std::string &tag)
+{
+    static const std::map<std::string, FwkDataType> kTypes = {
+        {"torch.op_range", FwkDataType::OP_RANGE_DATA},
+        {"torch.op_mark", FwkDataType::OP_MARK_DATA},
+        {"torch.memory_usage", FwkDataType::MEMORY_DATA},
+    };
+    auto iter = kTypes.find(tag);
+    return iter == kTypes.end() ? 0 : static_cast<uint16_t>(iter->second);
+}
+
+uint64_t recordId(uint16_t type, const std::vector<uint8_t> &buf, size_t payload)
+{
+    switch (static_cast<FwkDataType>(type)) {
+        case FwkDataType::OP_RANGE_DATA:
+            return readFixed<uint64_t>(buf, payload + 2 * sizeof(int64_t)); // sequence_number
+        case FwkDataType::OP_MARK_DATA:
+            return readFixed<uint64_t>(buf, payload + 2 * sizeof(uint64_t)); // correlation_id
+        default:
+            return readFixed<uint64_t>(buf, payload); // ptr
+    }
+}
+
+// Decodes every file of the dump dir and checks each record against the one
+// generated for its id. Returns the number of records found.
+uint64_t verifyDump(const std::string &path)
+{
+    uint64_t dumped = 0;
+    std::unordered_set<uint64_t> seen;
+    for (const char *tag : {"torch.op_range", "torch.op_mark", "torch.memory_usage"}) {
+        const auto buf = readDumpFile(path + "/" + tag);
+        size_t offset = 0;
+        while (offset < buf.size()) {
+            if (buf.size() - offset < kTLVHeaderSize) {
+                ADD_FAILURE() << "truncated header at " << offset << " in " << tag;
+                break;
+            }
+            const uint16_t type = readFixed<uint16_t>(buf, offset);
+            const uint32_t length = readFixed<uint32_t>(buf, offset + sizeof(uint16_t));
+            if (buf.size() - offset - kTLVHeaderSize < length) {
+                ADD_FAILURE() << "truncated record at " << offset << " in " << tag;
+                break;
+            }
+            EXPECT_EQ(type, expectedType(tag)) << "record of another tag at " << offset << " in " << tag;
+            const uint64_t id = recordId(type, buf, offset + kTLVHeaderSize);
+            EXPECT_TRUE(seen.insert(id).second) << "duplicated record " << id;
+            auto expected = makeRecord(id);
+            std::vector<uint8_t> encoded;
+            expected->encode(encoded);
+            EXPECT_EQ(expected->tag, tag) << "record " << id;
+            EXPECT_TRUE(encoded.size() == kTLVHeaderSize + length &&
+                        std::equal(encoded.begin(), encoded.end(), buf.begin() + offset))
+                << "record " << id << " differs";
+            offset += kTLVHeaderSize + length;
+            ++dumped;
+        }
+    }
+    return dumped;
+}
+
+double percentileUs(std::vector<uint64_t> &latencies, double quantile)
+{
+    if (latencies.empty()) {
+        return 0;
+    }
+    auto nth = latencies.begin() + static_cast<size_t>(quantile * (latencies.size() - 1));
+    std::nth_element(latencies.begin(), nth, latencies.end());
+    return static_cast<double>(*nth) / 1000;
+}
+
+// Runs `producers` threads of `records` reports each through `report`, paced
+// to the configured rate, and returns the p99 latency of a report call.
+template<typename Report>
+double produce(const PipelineConfig &config, Report report)
+{
+    std::vector<std::vector<uint64_t>> latencies(config.producers);
+    std::vector<std::thread> producers;
+    for (int64_t p = 0; p < config.producers; ++p) {
+        producers.emplace_back([&config, &latencies, &report, p] {
+            auto &latency = latencies[p];
+            latency.reserve(config.records);
+            const auto begin = std::chrono::steady_clock::now();
+            for (int64_t i = 0; i < config.records; ++i) {
+                if (config.rate > 0) {
+                    std::this_thread::sleep_until(begin + std::chrono::nanoseconds(i * 1000000000LL / config.rate));
+                }
+                latency.push_back(report((static_cast<uint64_t>(p) << 32) | static_cast<uint64_t>(i)));
+            }
+        });
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    std::vector<uint64_t> all;
+    for (const auto &latency : latencies) {
+        all.insert(all.end(), latency.begin(), latency.end());
+    }
+    return percentileUs(all, 0.99);
+}
+
+uint64_t elapsedNs(std::chrono::steady_clock::time_point start)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count());
+}
+
+PipelineResult runDataDumper(const PipelineConfig &config, bool compress)
+{
+    TempDir dir;
+    EXPECT_FALSE(dir.path().empty());
+    PipelineResult result;
+    DataDumper dumper;
+    dumper.Init(dir.path(), config.capacity, compress);
+    dumper.Start();
+    const auto start = std::chrono::steady_clock::now();
+    result.p99Us = produce(config, [&dumper](uint64_t id) {
+        // Encoding into the thread's chunk is part of the report, building
+        // the record is the producer's own business and is left out.
+        auto record = makeRecord(id);
+        const auto begin = std::chrono::steady_clock::now();
+        dumper.Report(std::move(record));
+        return elapsedNs(begin);
+    });
+    dumper.Stop();
+    result.seconds = static_cast<double>(elapsedNs(start)) / 1e9;
+    result.produced = static_cast<uint64_t>(config.producers * config.records);
+    result.dropped = dumper.GetDroppedCount();
+    // Closes the files, which writes the index of compressed ones.
+    dumper.UnInit();
+    result.dumped = verifyDump(dir.path());
+    return result;
+}
+
+// Records the measurements as test properties, which land in the gtest XML
+// report, and checks them against the bounds that are set.
+void checkResult(const PipelineConfig &config, const PipelineResult &result)
+{
+    const double recordsPerSecond = result.dumped / std::max(result.seconds, 1e-9);
+    const double dropPpm = 1e6 * result.dropped / std::max<uint64_t>(result.produced, 1);
+    testing::Test::RecordProperty("records_per_second", std::to_string(static_cast<uint64_t>(recordsPerSecond)));
+    testing::Test::RecordProperty("drop_ppm", std::to_string(dropPpm));
+    testing::Test::RecordProperty("p99_enqueue_us", std::to_string(result.p99Us));
+
+    ASSERT_EQ(result.dumped + result.dropped, result.produced);
+    if (config.maxDropPpm != kUnbounded) {
+        EXPECT_LE(dropPpm, static_cast<double>(config.maxDropPpm));
+    }
+    if (config.maxP99Us != kUnbounded) {
+        EXPECT_LE(result.p99Us, static_cast<double>(config.maxP99Us));
+    }
+    if (config.minRate != kUnbounded) {
+        // A paced run cannot be faster than its producers.
+        double minRate = static_cast<double>(config.minRate);
+        if (config.rate > 0) {
+            minRate = std::min(minRate, 0.5 * static_cast<double>(config.rate * config.producers));
+        }
+        EXPECT_GE(recordsPerSecond, minRate);
+    }
+}
+
+} // namespace
+
+TEST(RingBufferTest, ConcurrentProducersKeepEveryRecord)
+{
+    // Producers fill their claimed slots out of order, no record may be lost
+    // or read before it was written.
+    constexpr uint64_t kProducers = 4;
+    constexpr uint64_t kRecords = 100000;
+    RingBuffer<std::unique_ptr<uint64_t>> ring;
+    ring.Init(256);
+    std::vector<std::thread> producers;
+    for (uint64_t p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&ring, p] {
+            for (uint64_t i = 0; i < kRecords; ++i) {
+                while (!ring.Push(std::make_unique<uint64_t>(p * kRecords + i))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    std::vector<uint64_t> next(kProducers, 0);
+    for (uint64_t popped = 0; popped < kProducers * kRecords;) {
+        std::unique_ptr<uint64_t> value;
+        if (!ring.Pop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        ASSERT_NE(value, nullptr);
+        const uint64_t producer = *value / kRecords;
+        ASSERT_LT(producer, kProducers);
+        // Each producer's records come out in the order it pushed them.
+        ASSERT_EQ(*value % kRecords, next[producer]++);
+        ++popped;
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    EXPECT_EQ(ring.Size(), 0U);
+}
+
+TEST(DataDumperTest, LargeRecordKeptWhole)
+{
+    TempDir dir;
+    ASSERT_FALSE(dir.path().empty());
+    DataDumper dumper;
+    dumper.Init(dir.path(), kDefaultRingBuffer);
+    dumper.Start();
+    for (uint64_t id : {1, 2, 3}) {
+        auto data = std::make_unique<OpRangeData>(0, 1, static_cast<int64_t>(id), 1, 2, 2, 2, false, "aten::add");
+        // Neither cut nor reordered when it exceeds a chunk and a batch.
+        data->stack = {std::string(id == 2 ? kBatchMaxLen + 1 : 16, 's')};
+        dumper.Report(std::move(data));
+    }
+    dumper.Stop();
+    dumper.UnInit();
+    const auto buf = readDumpFile(dir.path() + "/torch.op_range");
+    size_t offset = 0;
+    for (uint64_t id : {1, 2, 3}) {
+        ASSERT_LE(offset + kTLVHeaderSize, buf.size());
+        EXPECT_EQ(recordId(readFixed<uint16_t>(buf, offset), buf, offset + kTLVHeaderSize), id);
+        offset += kTLVHeaderSize + readFixed<uint32_t>(buf, offset + sizeof(uint16_t));
+    }
+    EXPECT_EQ(offset, buf.size());
+}
+
+TEST(DataDumperTest, SharedChunksKeepReportOrder)
+{
+    constexpr int64_t kThreads = 4;
+    constexpr int64_t kRecords = 20000;
+    TempDir dir;
+    ASSERT_FALSE(dir.path().empty());
+    DataDumper dumper;
+    dumper.Init(dir.path(), kDefaultRingBuffer, false, true);
+    dumper.Start();
+    std::mutex mutex;
+    int64_t next = 0;
+    std::vector<std::thread> threads;
+    for (int64_t t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&dumper, &mutex, &next] {
+            for (int64_t i = 0; i < kRecords; ++i) {
+                std::lock_guard<std::mutex> lock(mutex);
+                dumper.Report(std::make_unique<OpMarkData>(0, 0, static_cast<uint64_t>(next++), 0, 0, "mark"));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    dumper.Stop();
+    ASSERT_EQ(dumper.GetDroppedCount(), 0U);
+    dumper.UnInit();
+    const auto buf = readDumpFile(dir.path() + "/torch.op_mark");
+    size_t offset = 0;
+    for (int64_t id = 0; id < kThreads * kRecords; ++id) {
+        ASSERT_LE(offset + kTLVHeaderSize, buf.size());
+        ASSERT_EQ(recordId(readFixed<uint16_t>(buf, offset), buf, offset + kTLVHeaderSize), static_cast<uint64_t>(id));
+        offset += kTLVHeaderSize + readFixed<uint32_t>(buf, offset + sizeof(uint16_t));
+    }
+    EXPECT_EQ(offset, buf.size());
+}
+
+TEST(DataDumperTest, PipelineRoundTrip)
+{
+    const auto config = pipelineConfig();
+    const auto result = runDataDumper(config, false);
+    checkResult(config, result);
+}
+
+TEST(DataDumperTest, CompressedPipelineRoundTrip)
+{
+    const auto config = pipelineConfig();
+    const auto result = runDataDumper(config, true);
+    checkResult(config, result);
+}
+
+TEST(TraceDataDumperTest, PipelineRoundTrip)
+{
+    // Each report is a batch of python events, as the tracer hands them over.
+    constexpr uint64_t kEventsPerBatch = 64;
+    auto config = pipelineConfig();
+    config.records = std::max<int64_t>(config.records / static_cast<int64_t>(kEventsPerBatch), 1);
+    if (config.minRate != kUnbounded) {
+        config.minRate = std::max<int64_t>(config.minRate / static_cast<int64_t>(kEventsPerBatch), 1);
+    }
+    TempDir dir;
+    ASSERT_FALSE(dir.path().empty());
+    TraceDataDumper dumper;
+    dumper.Init(dir.path(), config.capacity);
+    dumper.Start();
+    const auto start = std::chrono::steady_clock::now();
+    PipelineResult result;
+    result.p99Us = produce(config, [&dumper](uint64_t id) {
+        AppendOnlyList<TraceEvent> events;
+        for (uint64_t i = 0; i < kEventsPerBatch; ++i) {
+            events.emplace_back(id, id * kEventsPerBatch + i, id * kEventsPerBatch + i,
+                                i % 2 == 0 ? TraceTag::kPy_Call : TraceTag::kPy_Return);
+        }
+        auto data = std::make_unique<PythonTracerFuncData>(7, std::move(events));
+        const auto begin = std::chrono::steady_clock::now();
+        dumper.Report(std::move(data));
+        return elapsedNs(begin);
+    });
+    dumper.ReportHash(std::make_unique<PythonTracerHashData>(
+        std::vector<std::pair<uint64_t, std::string>>{{1, "train.py(42): step"}, {2, "model.py(17): forward"}}));
+    dumper.ReportSample(std::make_unique<PythonSampleData>(
+        1000, std::vector<PythonSampleNode>{{1, 1, 3, 1, 0}, {1, 2, 5, 2, 1}}));
+    dumper.Stop();
+    result.seconds = static_cast<double>(elapsedNs(start)) / 1e9;
+    result.produced = static_cast<uint64_t>(config.producers * config.records);
+    result.dropped = dumper.GetDroppedCount();
+    dumper.UnInit();
+
+    const auto trace = readDumpFile(dir.path() + "/torch.python_tracer_func");
+    ASSERT_EQ(trace.size() % kTraceEventSize, 0U);
+    std::unordered_set<uint64_t> seen;
+    for (size_t offset = 0; offset < trace.size(); offset += kTraceEventSize) {
+        const uint64_t ts = readFixed<uint64_t>(trace, offset);
+        const uint64_t tid = readFixed<uint64_t>(trace, offset + sizeof(uint64_t));
+        EXPECT_EQ(ts / kEventsPerBatch, tid);
+        EXPECT_EQ(readFixed<uint64_t>(trace, offset + 2 * sizeof(uint64_t)), 7U);
+        EXPECT_EQ(readFixed<uint64_t>(trace, offset + 3 * sizeof(uint64_t)), ts);
+        EXPECT_EQ(readFixed<uint8_t>(trace, offset + 4 * sizeof(uint64_t)), ts % 2);
+        EXPECT_TRUE(seen.insert(ts).second) << "duplicated event " << ts;
+    }
+    result.dumped = seen.size() / kEventsPerBatch;
+    EXPECT_EQ(seen.size() % kEventsPerBatch, 0U);
+    checkResult(config, result);
+
+    const auto hash = readDumpFile(dir.path() + "/torch.python_tracer_hash");
+    size_t hashRecords = 0;
+    for (size_t offset = 0; offset + kTLVHeaderSize <= hash.size(); ++hashRecords) {
+        EXPECT_EQ(readFixed<uint16_t>(hash, offset), static_cast<uint16_t>(FwkDataType::PYTHON_TRACER_HASH_DATA));
+        offset += kTLVHeaderSize + readFixed<uint32_t>(hash, offset + sizeof(uint16_t));
+    }
+    EXPECT_EQ(hashRecords, 2U);
+
+    const auto sample = readDumpFile(dir.path() + "/torch.python_sample");
+    ASSERT_EQ(sample.size(), 2 * kSampleNodeSize);
+    EXPECT_EQ(readFixed<uint64_t>(sample, kSampleNodeSize + 2 * sizeof(uint64_t)), 5U);
+    EXPECT_EQ(readFixed<uint32_t>(sample, kSampleNodeSize + 3 * sizeof(uint64_t) + sizeof(uint32_t)), 1U);
+    EXPECT_EQ(readFixed<uint32_t>(sample, kSampleNodeSize + 3 * sizeof(uint64_t) + 2 * sizeof(uint32_t)), 1000U);
+}
@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "torch_npu/csrc/toolkit/profiler/inc/data_dumper.h"
+#include "torch_npu/csrc/toolkit/profiler/inc/data_reporter.h"
+
+using namespace torch_npu::toolkit::profiler;
+
+namespace {
+
+constexpr size_t kTLVHeaderSize = sizeof(uint16_t) + sizeof(uint32_t);
+
+template<typename T>
+T readFixed(const std::vector<uint8_t> &buf, size_t offset)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        value |= static_cast<uint64_t>(buf[offset + i]) << (i * 8);
+    }
+    return static_cast<T>(value);
+}
+
+std::unique_ptr<OpRangeData> makeOpRange(int64_t i)
+{
+    auto data = std::make_unique<OpRangeData>(i, i + 100, i, 1, 2, 2, 2, false, "aten::add");
+    data->input_dtypes = {"float", "float", "Scalar"};
+    data->input_shapes = {{32, 1024}, {32, 1024}, {}};
+    data->stack = {"train.py(42): step", "model.py(17): forward"};
+    return data;
+}
+
+double recordsPerSecond(size_t records, std::chrono::steady_clock::duration elapsed)
+{
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    return records * 1e9 / std::max<int64_t>(ns, 1);
+}
+
+} // namespace
+
+TEST(DataReporterTest, OpMarkLayout)
+{
+    OpMarkData data(123, 1, 7, 8, 9, "Enqueue");
+    std::vector<uint8_t> buf;
+    data.encode(buf);
+
+    const size_t payload = sizeof(int64_t) + 4 * sizeof(uint64_t) + kTLVHeaderSize + data.name.size();
+    ASSERT_EQ(buf.size(), kTLVHeaderSize + payload);
+    EXPECT_EQ(readFixed<uint16_t>(buf, 0), static_cast<uint16_t>(FwkDataType::OP_MARK_DATA));
+    EXPECT_EQ(readFixed<uint32_t>(buf, sizeof(uint16_t)), payload);
+    EXPECT_EQ(readFixed<int64_t>(buf, kTLVHeaderSize), 123);
+    EXPECT_EQ(readFixed<uint64_t>(buf, kTLVHeaderSize + sizeof(int64_t) + sizeof(uint64_t)), 7U);
+    EXPECT_EQ(std::string(buf.end() - data.name.size(), buf.end()), data.name);
+}
+
+TEST(DataReporterTest, EncodeAppendsToBuffer)
+{
+    MemoryData first(1, 2, 3, 4, 5, 6, 7, 20, 0, 0, 0, 8, 9);
+    MemoryData second(10, 20, 30, 40, 50, 60, 70, 20, 1, 1, 0, 80, 90);
+    std::vector<uint8_t> alone;
+    second.encode(alone);
+
+    std::vector<uint8_t> buf;
+    first.encode(buf);
+    size_t firstSize = buf.size();
+    second.encode(buf);
+    ASSERT_EQ(buf.size(), firstSize + alone.size());
+    EXPECT_TRUE(std::equal(alone.begin(), alone.end(), buf.begin() + firstSize));
+}
+
+TEST(DataReporterTest, StrArrayMatchesJoinedString)
+{
+    std::vector<uint8_t> joined;
+    encodeStrData(3, "float;;int64", joined);
+    std::vector<uint8_t> array;
+    encodeStrArrayData(3, {"float", "", "int64"}, array);
+    EXPECT_EQ(joined, array);
+
+    std::vector<uint8_t> matrix;
+    encode2DIntegerMatrixDatas<int64_t>(4, {{2, -3}, {}, {5}}, matrix);
+    std::vector<uint8_t> expected;
+    encodeStrData(4, "2,-3;;5", expected);
+    EXPECT_EQ(matrix, expected);
+}
+
+TEST(DataReporterTest, UnsignedMatrixKeepsFullRange)
+{
+    std::vector<uint8_t> matrix;
+    encode2DIntegerMatrixDatas<uint64_t>(4, {{std::numeric_limits<uint64_t>::max(), 0}, {1}}, matrix);
+    std::vector<uint8_t> expected;
+    encodeStrData(4, "18446744073709551615,0;1", expected);
+    EXPECT_EQ(matrix, expected);
+}
+
+// Records per second of the encoding on the report path, for the previous
+// scheme, a fresh vector per record appended to the batch of its tag, and for
+// encoding in place into a ReportChunk that is recycled once handed off.
+TEST(DataReporterBenchmark, OpRangeRecordsPerSecond)
+{
+    constexpr int64_t kRecords = 200000;
+    std::vector<std::unique_ptr<OpRangeData>> records;
+    records.reserve(kRecords);
+    for (int64_t i = 0; i < kRecords; ++i) {
+        records.push_back(makeOpRange(i));
+    }
+
+    uint64_t vectorBytes = 0;
+    std::map<std::string, std::vector<uint8_t>> batches;
+    auto start = std::chrono::steady_clock::now();
+    for (const auto &record : records) {
+        std::vector<uint8_t> encoded;
+        record->encode(encoded);
+        auto &batch = batches[record->tag];
+        batch.insert(batch.end(), encoded.cbegin(), encoded.cend());
+        if (batch.size() >= kBatchMaxLen) {
+            vectorBytes += batch.size();
+            batch = std::vector<uint8_t>();
+        }
+    }
+    for (const auto &batch : batches) {
+        vectorBytes += batch.second.size();
+    }
+    double vectorRate = recordsPerSecond(kRecords, std::chrono::steady_clock::now() - start);
+
+    uint64_t chunkBytes = 0;
+    ReportChunk chunk;
+    chunk.data.reserve(kReportChunkSize);
+    start = std::chrono::steady_clock::now();
+    for (const auto &record : records) {
+        record->encode(chunk.data);
+        chunk.records++;
+        if (chunk.data.size() + kReportChunkHeadroom > kReportChunkSize) {
+            chunkBytes += chunk.data.size();
+            chunk.data.clear();
+            chunk.records = 0;
+        }
+    }
+    chunkBytes += chunk.data.size();
+    double chunkRate = recordsPerSecond(kRecords, std::chrono::steady_clock::now() - start);
+
+    EXPECT_EQ(vectorBytes, chunkBytes);
+    testing::Test::RecordProperty("vector_records_per_second", std::to_string(static_cast<uint64_t>(vectorRate)));
+    testing::Test::RecordProperty("chunk_records_per_second", std::to_string(static_cast<uint64_t>(chunkRate)));
+    std::cout << "OpRangeData records/s: per-record vector " << vectorRate << ", ReportChunk " << chunkRate
+              << std::endl;
+}
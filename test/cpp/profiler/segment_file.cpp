@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "torch_npu/csrc/toolkit/profiler/inc/segment_file.h"
+
+using namespace torch_npu::toolkit::profiler;
+
+namespace {
+
+template<typename T>
+T readFixed(const std::vector<uint8_t> &buf, size_t offset)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        value |= static_cast<uint64_t>(buf[offset + i]) << (i * 8);
+    }
+    return static_cast<T>(value);
+}
+
+std::vector<uint8_t> makeRecords(size_t size, uint32_t seed)
+{
+    // TLV like data: repeated names and shapes with varying timestamps.
+    static const std::string kRecord = "aten::add;float;float;32,1024;32,1024;train.py(42): step";
+    std::mt19937 rng(seed);
+    std::vector<uint8_t> data;
+    while (data.size() < size) {
+        for (int i = 0; i < 8; ++i) {
+            data.push_back(static_cast<uint8_t>(rng()));
+        }
+        data.insert(data.end(), kRecord.begin(), kRecord.end());
+    }
+    data.resize(size);
+    return data;
+}
+
+std::vector<uint8_t> readFile(const std::string &path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+} // namespace
+
+TEST(SegmentFileTest, Lz4RoundTrip)
+{
+    std::mt19937 rng(7);
+    for (size_t size : {0, 1, 12, 13, 100, 65536, 300000}) {
+        std::vector<uint8_t> random(size);
+        for (auto &byte : random) {
+            byte = static_cast<uint8_t>(rng());
+        }
+        for (const auto &data : {random, makeRecords(size, 1), std::vector<uint8_t>(size, 'a')}) {
+            std::vector<uint8_t> compressed;
+            Lz4CompressBlock(data.data(), data.size(), compressed);
+            std::vector<uint8_t> decompressed(data.size());
+            ASSERT_TRUE(Lz4DecompressBlock(compressed.data(), compressed.size(), decompressed.data(), size));
+            EXPECT_EQ(decompressed, data);
+        }
+    }
+}
+
+TEST(SegmentFileTest, Lz4RejectsWrongSize)
+{
+    auto data = makeRecords(4096, 2);
+    std::vector<uint8_t> compressed;
+    Lz4CompressBlock(data.data(), data.size(), compressed);
+    EXPECT_LT(compressed.size(), data.size() / 2);
+    std::vector<uint8_t> decompressed(data.size() + 1);
+    EXPECT_FALSE(Lz4DecompressBlock(compressed.data(), compressed.size(), decompressed.data(), data.size() + 1));
+    EXPECT_FALSE(Lz4DecompressBlock(compressed.data(), compressed.size() - 1, decompressed.data(), data.size()));
+}
+
+TEST(SegmentFileTest, IndexedSegments)
+{
+    const std::string path = "segment_file_test.npuz";
+    std::vector<std::vector<uint8_t>> segments = {makeRecords(5000, 3), makeRecords(200000, 4), {'x', 'y'}};
+    {
+        SegmentFile file;
+        ASSERT_TRUE(file.Open(path));
+        for (const auto &segment : segments) {
+            ASSERT_TRUE(file.Append(segment));
+        }
+    }
+    auto buf = readFile(path);
+    std::remove(path.c_str());
+    ASSERT_GT(buf.size(), kSegmentFileHeaderSize + kSegmentTrailerSize);
+    EXPECT_EQ(readFixed<uint32_t>(buf, 0), kSegmentFileMagic);
+    EXPECT_EQ(readFixed<uint16_t>(buf, 4), kSegmentFileVersion);
+
+    const size_t trailer = buf.size() - kSegmentTrailerSize;
+    EXPECT_EQ(readFixed<uint32_t>(buf, trailer + 16), kSegmentIndexMagic);
+    ASSERT_EQ(readFixed<uint64_t>(buf, trailer + 8), segments.size());
+    const size_t index = readFixed<uint64_t>(buf, trailer);
+    ASSERT_EQ(index + segments.size() * kSegmentIndexEntrySize, trailer);
+
+    uint64_t rawOffset = 0;
+    for (size_t i = 0; i < segments.size(); ++i) {
+        const size_t entry = index + i * kSegmentIndexEntrySize;
+        const size_t offset = readFixed<uint64_t>(buf, entry);
+        const uint32_t compressedSize = readFixed<uint32_t>(buf, entry + 16);
+        const uint32_t rawSize = readFixed<uint32_t>(buf, entry + 20);
+        EXPECT_EQ(readFixed<uint64_t>(buf, entry + 8), rawOffset);
+        ASSERT_EQ(rawSize, segments[i].size());
+        EXPECT_EQ(readFixed<uint32_t>(buf, offset), compressedSize);
+        EXPECT_EQ(readFixed<uint32_t>(buf, offset + 4), rawSize);
+
+        const uint8_t *payload = buf.data() + offset + kSegmentHeaderSize;
+        std::vector<uint8_t> raw(rawSize);
+        if (compressedSize == rawSize) {
+            raw.assign(payload, payload + rawSize);
+        } else {
+            ASSERT_TRUE(Lz4DecompressBlock(payload, compressedSize, raw.data(), rawSize));
+        }
+        EXPECT_EQ(raw, segments[i]);
+        rawOffset += rawSize;
+    }
+}
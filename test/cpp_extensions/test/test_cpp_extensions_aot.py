@@ -110,6 +110,28 @@ class TestCppExtensionAOT(TestCase):
         self.assertEqual(output_2.cpu(), expected)
         self.assertEqual(output_3.cpu(), expected)
 
+    def test_op_hook_sampling_with_add(self):
+        input_1 = torch.tensor((4, 4)).npu()
+        input_2 = torch.tensor((4, 4)).npu()
+        npu_extension.register_op_hook()
+        torch.npu.set_option({"OP_HOOK_ENABLE": "enable"})
+        try:
+            # ops outside the op list are not hooked
+            torch.npu.set_option({"OP_HOOK_OP_LIST": "not_an_op"})
+            npu_extension.reset_op_hook_call_count()
+            torch.add(input_1, input_2)
+            self.assertEqual(npu_extension.get_op_hook_call_count(), 0)
+
+            # every other call is hooked
+            torch.npu.set_option({"OP_HOOK_OP_LIST": "", "OP_HOOK_SAMPLE_INTERVAL": "2"})
+            npu_extension.reset_op_hook_call_count()
+            for _ in range(4):
+                torch.add(input_1, input_2)
+            self.assertEqual(npu_extension.get_op_hook_call_count(), 10)
+        finally:
+            torch.npu.set_option({"OP_HOOK_ENABLE": "disable", "OP_HOOK_OP_LIST": "",
+                                  "OP_HOOK_SAMPLE_INTERVAL": "1"})
+
     @classmethod
     def _init_dist_hccl(cls, rank, world_size):
         os.environ['MASTER_ADDR'] = '127.0.0.1'
@@ -150,6 +172,28 @@ class TestCppExtensionAOT(TestCase):
         op_hook_count = (count_1, count_2, count_3, count_4)
         c2p.put((rank, dst, all_reduce_ouput, op_hook_count))
 
+    @classmethod
+    def _test_op_hook_sampling_with_async_all_reduce(cls, rank, input1, world_size, init_pg, c2p):
+        dist_group = init_pg(rank, world_size)
+        input_1 = input1.npu()
+        input_2 = input1.npu()
+        npu_extension.register_op_hook()
+        # every other allreduce is hooked, the first one issued is
+        torch.npu.set_option({"OP_HOOK_OP_LIST": "allreduce", "OP_HOOK_SAMPLE_INTERVAL": "2"})
+        torch.npu.set_option({"OP_HOOK_ENABLE": "enable"})
+        npu_extension.reset_op_hook_call_count()
+        work_1 = dist_group.all_reduce(input_1, async_op=True)
+        work_2 = dist_group.all_reduce(input_2, async_op=True)
+        count_issued = npu_extension.get_op_hook_call_count()
+        # both are outstanding, waiting on the first ends its hook
+        work_1.wait()
+        count_1 = npu_extension.get_op_hook_call_count()
+        work_2.wait()
+        count_2 = npu_extension.get_op_hook_call_count()
+        torch.npu.set_option({"OP_HOOK_ENABLE": "disable", "OP_HOOK_OP_LIST": "",
+                              "OP_HOOK_SAMPLE_INTERVAL": "1"})
+        c2p.put((rank, (count_issued, count_1, count_2)))
+
     def _test_multiprocess(self, f, init_pg, expected, input1, world_size):
         ctx = mp.get_context('spawn')
         c2p = ctx.Queue(world_size)
@@ -194,5 +238,27 @@ class TestCppExtensionAOT(TestCase):
             self._test_multiprocess(TestCppExtensionAOT._test_op_hook_with_all_reduce,
                                     TestCppExtensionAOT._init_dist_hccl, expected, input1, world_size)
 
+    @skipIfUnsupportMultiNPU(2)
+    def test_op_hook_sampling_with_async_all_reduce(self):
+        world_size = 2
+        _, input1 = create_common_tensor([np.float32, 2, [2, 3, 16]], -10, 10)
+        ctx = mp.get_context('spawn')
+        c2p = ctx.Queue(world_size)
+        ps = []
+        for i in range(world_size):
+            p = ctx.Process(
+                target=TestCppExtensionAOT._test_op_hook_sampling_with_async_all_reduce,
+                args=(i, input1.cpu(), world_size, TestCppExtensionAOT._init_dist_hccl, c2p))
+            p.start()
+            ps.append(p)
+
+        for _ in range(world_size):
+            rank, op_hook_count = c2p.get()
+            # begin and one input for the sampled call, its end once waited on
+            self.assertEqual(op_hook_count, (2, 3, 3), "rank {}".format(rank))
+
+        for p in ps:
+            p.join()
+
 if __name__ == "__main__":
     run_tests()
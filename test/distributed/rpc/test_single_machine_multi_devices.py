@@ -319,6 +319,31 @@ class TestRpc(TestCase):
                          backend=rpc.backend_registry.BackendType.NPU_TENSORPIPE)
         rpc.shutdown()
 
+    @classmethod
+    def _test_pipelined_channel_for_npu(cls, pid, inputs, world_size):
+        # Small chunks and a shallow ring so that the tensors span many chunks
+        # and the last chunk is partial. The peers use different chunk sizes,
+        # receivers follow the one chosen by the sender.
+        os.environ['TP_NPU_PIPELINE_CHUNK_BYTES'] = str((64 if pid == 0 else 48) * 1024)
+        os.environ['TP_NPU_PIPELINE_DEPTH'] = '2'
+        npu_id_, worker_name_ = TestRpc.init_worker_info(pid)
+        if pid == 0:
+            options = TestRpc.set_options()
+            options._channels = ['npu_pipelined', 'basic']
+            rpc.init_rpc(worker_name_, rank=pid, world_size=world_size,
+                         backend=rpc.backend_registry.BackendType.NPU_TENSORPIPE, rpc_backend_options=options)
+            for cpu_input in inputs:
+                input1 = cpu_input.npu()
+                rets = rpc.rpc_sync('worker1', TestRpc.echo, args=(input1, cpu_input))
+                TestCase().assertEqual(rets[0].cpu(), cpu_input)
+                TestCase().assertEqual(rets[1], cpu_input)
+        else:
+            options = NPUTensorPipeRpcBackendOptions(num_worker_threads=8)
+            options._channels = ['npu_pipelined', 'basic']
+            rpc.init_rpc(worker_name_, rank=pid, world_size=world_size,
+                         backend=rpc.backend_registry.BackendType.NPU_TENSORPIPE, rpc_backend_options=options)
+        rpc.shutdown()
+
     def _test_multiprocess(self, f, inputs, world_size):
         ctx = mp.get_context('spawn')
         ps = []
@@ -350,6 +375,11 @@ class TestRpc(TestCase):
         inputs = [torch.rand(1024, 1024), torch.rand(1024, 1024, 1024)]
         self._test_multiprocess(TestRpc._test_sync_call_for_npu, inputs, self.world_size_2p)
 
+    @skipIfUnsupportMultiNPU(2)
+    def test_pipelined_channel_for_npu(self):
+        inputs = [torch.rand(7), torch.rand(1000003), torch.rand(1024, 1024)]
+        self._test_multiprocess(TestRpc._test_pipelined_channel_for_npu, inputs, self.world_size_2p)
+
     @skipIfUnsupportMultiNPU(3)
     def test_remote_rref(self):
         inputs = [torch.rand(1024, 1024), torch.rand(1024, 1024, 1024), 3, 1]
@@ -0,0 +1,90 @@
+import os
+
+import torch
+import torch.distributed as dist
+import torch.multiprocessing as mp
+import torch_npu
+from torch_npu.testing.common_distributed import skipIfUnsupportMultiNPU
+from torch_npu.testing.testcase import TestCase, run_tests
+
+
+class AllToAllSingleDeviceSplitsTest(TestCase):
+    @classmethod
+    def _init_dist_hccl(cls, rank, world_size):
+        os.environ['MASTER_ADDR'] = '127.0.0.1'
+        os.environ['MASTER_PORT'] = '29500'
+        os.environ['HCCL_WHITELIST_DISABLE'] = '1'
+        torch_npu.npu.set_device(rank)
+        dist.init_process_group(backend='hccl', world_size=world_size, rank=rank)
+        return dist
+
+    @classmethod
+    def _test_device_splits(cls, rank, world_size, init_pg, exchange):
+        init_pg(rank, world_size)
+        # Rank r sends (r + 1) * (peer + 1) rows of width 3 to each peer.
+        input_splits = [(rank + 1) * (peer + 1) for peer in range(world_size)]
+        output_splits = [(peer + 1) * (rank + 1) for peer in range(world_size)]
+        input = torch.arange(sum(input_splits) * 3, dtype=torch.float32).view(-1, 3) + rank * 1000
+        expected = torch.empty(sum(output_splits), 3).npu()
+        dist.all_to_all_single(expected, input.npu(), output_splits, input_splits)
+
+        input_split_sizes = torch.tensor(input_splits, dtype=torch.int64).npu()
+        if exchange:
+            output_split_sizes = torch.zeros(world_size, dtype=torch.int64).npu()
+        else:
+            output_split_sizes = torch.tensor(output_splits, dtype=torch.int64).npu()
+        # Room for more rows than are received, as when the counts are unknown on the host.
+        output = torch.zeros(sum(output_splits) + 4, 3).npu()
+        torch_npu.distributed.all_to_all_single_device_splits(
+            output, input.npu(), output_split_sizes, input_split_sizes, exchange_split_sizes=exchange)
+
+        assert output_split_sizes.cpu().tolist() == output_splits
+        assert torch.equal(output[:sum(output_splits)].cpu(), expected.cpu())
+        assert torch.equal(output[sum(output_splits):].cpu(), torch.zeros(4, 3))
+
+    @classmethod
+    def _test_invalid_device_splits(cls, rank, world_size, init_pg, exchange):
+        init_pg(rank, world_size)
+        input = torch.ones(4, 3).npu()
+        output = torch.zeros(4, 3).npu()
+        # More rows than the input holds, raised before anything is launched.
+        input_split_sizes = torch.tensor([4, 1], dtype=torch.int64).npu()
+        output_split_sizes = torch.tensor([2, 2], dtype=torch.int64).npu()
+        try:
+            torch_npu.distributed.all_to_all_single_device_splits(
+                output, input, output_split_sizes, input_split_sizes, exchange_split_sizes=False)
+        except RuntimeError as e:
+            assert "exceed the input tensor" in str(e)
+        else:
+            raise AssertionError("split sizes larger than the input were not rejected")
+
+    def _test_multiprocess(self, f, init_pg, world_size, exchange):
+        ctx = mp.get_context('spawn')
+        ps = []
+        for rank in range(world_size):
+            p = ctx.Process(target=f, args=(rank, world_size, init_pg, exchange))
+            p.start()
+            ps.append(p)
+
+        for p in ps:
+            p.join()
+            self.assertEqual(p.exitcode, 0)
+
+    @skipIfUnsupportMultiNPU(2)
+    def test_all_to_all_single_device_splits(self):
+        self._test_multiprocess(AllToAllSingleDeviceSplitsTest._test_device_splits,
+                                AllToAllSingleDeviceSplitsTest._init_dist_hccl, 2, False)
+
+    @skipIfUnsupportMultiNPU(2)
+    def test_all_to_all_single_device_splits_exchange(self):
+        self._test_multiprocess(AllToAllSingleDeviceSplitsTest._test_device_splits,
+                                AllToAllSingleDeviceSplitsTest._init_dist_hccl, 2, True)
+
+    @skipIfUnsupportMultiNPU(2)
+    def test_all_to_all_single_device_splits_invalid(self):
+        self._test_multiprocess(AllToAllSingleDeviceSplitsTest._test_invalid_device_splits,
+                                AllToAllSingleDeviceSplitsTest._init_dist_hccl, 2, False)
+
+
+if __name__ == '__main__':
+    run_tests()
@@ -112,6 +112,17 @@ class HcclAllGatherTest(HcclAllGatherTestBase):
         pg.barrier()
         p2c.get()
 
+    @classmethod
+    def _test_all_gather_flat_views(cls, rank, input1, world_size, init_pg, c2p, p2c):
+        pg = init_pg(rank, world_size)
+        input1 = input1.npu()
+        flat = torch.empty(world_size * input1.numel(), dtype=input1.dtype, device=input1.device)
+        gather_tensor = [chunk.view(input1.size()) for chunk in flat.chunk(world_size)]
+        pg.all_gather(gather_tensor, input1)
+        c2p.put((rank, [tensor.cpu() for tensor in gather_tensor]))
+        pg.barrier()
+        p2c.get()
+
     @skipIfUnsupportMultiNPU(2)
     def test_all_gather_dist(self):
         ranks = [2]
@@ -131,6 +142,18 @@ class HcclAllGatherTest(HcclAllGatherTestBase):
                 self._test_multiprocess(HcclAllGatherTest._test_all_gather,
                                         HcclAllGatherTest._init_dist_hccl, expected, input1, world_size)
 
+    @skipIfUnsupportMultiNPU(2)
+    def test_all_gather_dist_flat_views(self):
+        ranks = [2]
+        dtype_list = [np.float32, np.float16, np.int32]
+        shape_format = [[i, 0, [4, 9]] for i in dtype_list] + [[i, 0, [8]] for i in dtype_list]
+        for world_size in ranks:
+            for shape in shape_format:
+                _, input1 = create_common_tensor(shape, -10, 10)
+                expected = self._construct_excepted_result(input1, world_size)
+                self._test_multiprocess(HcclAllGatherTest._test_all_gather_flat_views,
+                                        HcclAllGatherTest._init_dist_hccl, expected, input1, world_size)
+
     @skipIfUnsupportMultiNPU(2)
     def test_all_gather_dist_different_shape(self):
         ranks = [2]
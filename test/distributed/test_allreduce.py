@@ -31,6 +31,22 @@ class HcomAllReduceTest(TestCase):
         dist_group.all_reduce(input1, reduce_op)
         c2p.put((rank, dst, input1.cpu()))
 
+    @classmethod
+    # pylint:disable=huawei-too-many-arguments
+    def _test_all_reduce_coalesced_fused(cls, rank, input1, world_size, init_pg, c2p, reduce_op=dist.ReduceOp.SUM):
+        # A 1MB cap with 3 x 384KB fp32 tensors forces more than one bucket.
+        os.environ['TORCH_HCCL_COALESCED_BUCKET_CAP_MB'] = '1'
+        dist_group = init_pg(rank, world_size)
+        dst = 0
+        tensors = [input1.npu() for _ in range(3)] + [input1.half().npu()]
+        work = dist_group.all_reduce_coalesced(tensors, reduce_op, async_op=True)
+        work.wait()
+        # result() must hand back the caller's tensors, not the cached buckets.
+        results = work.result()
+        if [r.data_ptr() for r in results] != [t.data_ptr() for t in tensors]:
+            results = [torch.zeros_like(t) for t in tensors]
+        c2p.put((rank, dst, torch.stack([t.float() for t in results]).cpu()))
+
     # pylint:disable=huawei-too-many-arguments
     def _test_multiprocess(self, f, init_pg, expected, input1, world_size, reduce_op=dist.ReduceOp.SUM):
         ctx = mp.get_context('spawn')
@@ -146,6 +162,21 @@ class HcomAllReduceTest(TestCase):
                                         HcomAllReduceTest._init_dist_hccl, expected, input1, world_size,
                                         dist.ReduceOp.AVG)
 
+    @skipIfUnsupportMultiNPU(2)
+    def test_dist_all_reduce_coalesced_fused(self):
+        ranks = [2]
+        shape_format = [np.float32, 2, [96, 1024]]
+        for world_size in ranks:
+            for reduce_op in [dist.ReduceOp.SUM, dist.ReduceOp.AVG]:
+                exp_input, input1 = create_common_tensor(shape_format, -10, 10)
+                expected = self._construct_excepted_result(exp_input, world_size, np.float32, reduce_op)
+                half_expected = self._construct_excepted_result(exp_input.astype(np.float16), world_size,
+                                                                np.float16, reduce_op)
+                expected = torch.stack([torch.from_numpy(expected)] * 3 +
+                                       [torch.from_numpy(half_expected).float()])
+                self._test_multiprocess(HcomAllReduceTest._test_all_reduce_coalesced_fused,
+                                        HcomAllReduceTest._init_dist_hccl, expected, input1, world_size, reduce_op)
+
 
 if __name__ == '__main__':
     run_tests()
@@ -0,0 +1,87 @@
+import os
+
+import torch
+import torch.distributed as dist
+import torch.multiprocessing as mp
+import torch_npu
+from torch_npu.testing.common_distributed import skipIfUnsupportMultiNPU
+from torch_npu.testing.testcase import TestCase, run_tests
+
+
+class CollectiveStatsTest(TestCase):
+    @classmethod
+    def _init_dist_hccl(cls, rank, world_size):
+        os.environ['MASTER_ADDR'] = '127.0.0.1'
+        os.environ['MASTER_PORT'] = '29500'
+        os.environ['HCCL_WHITELIST_DISABLE'] = '1'
+        torch_npu.npu.set_device(rank)
+        dist.init_process_group(backend='hccl', world_size=world_size, rank=rank)
+        return dist
+
+    @classmethod
+    def _test_collective_stats(cls, rank, world_size, init_pg):
+        init_pg(rank, world_size)
+        backend = dist.group.WORLD._get_backend(torch.device('npu'))
+        assert not backend.is_collective_stats_enabled()
+        backend.set_collective_stats_enabled(True)
+
+        tensor = torch.ones(1000, dtype=torch.float32).npu()
+        for _ in range(5):
+            dist.all_reduce(tensor)
+        gathered = torch.empty(1000 * world_size, dtype=torch.float16).npu()
+        dist.all_gather_into_tensor(gathered, torch.ones(1000, dtype=torch.float16).npu())
+
+        # Completed works are accounted for even before the watchdog retires them.
+        torch.npu.synchronize()
+        stats = backend.get_collective_stats()
+        by_op = {(row["op_type"], row["dtype"]): row for row in stats}
+        allreduce = by_op[("ALLREDUCE", "Float")]
+        assert allreduce["count"] == 5
+        assert allreduce["bytes"] == 5 * 4000
+        assert allreduce["size_bucket_bytes"] == 4096
+        assert 0 < allreduce["min_us"] <= allreduce["p50_us"] <= allreduce["p99_us"] <= allreduce["max_us"]
+        expected_busbw = allreduce["algbw_gbps"] * 2 * (world_size - 1) / world_size
+        assert abs(allreduce["busbw_gbps"] - expected_busbw) < 1e-6
+        allgather = by_op[("ALLGATHER", "Half")]
+        assert allgather["count"] == 1
+        assert allgather["bytes"] == 2000 * world_size
+        # A single message size does not determine alpha and beta.
+        assert backend._fit_allreduce_latency() is None
+
+        large = torch.ones(1 << 22, dtype=torch.float32).npu()
+        for _ in range(5):
+            dist.all_reduce(large)
+        torch.npu.synchronize()
+        alpha_us, beta_us_per_byte = backend._fit_allreduce_latency()
+        assert alpha_us >= 0
+        assert beta_us_per_byte > 0
+
+        backend.reset_collective_stats()
+        assert backend.get_collective_stats() == []
+        assert backend._fit_allreduce_latency() is None
+
+        backend.set_collective_stats_enabled(False)
+        dist.all_reduce(tensor)
+        torch.npu.synchronize()
+        assert backend.get_collective_stats() == []
+
+    def _test_multiprocess(self, f, init_pg, world_size):
+        ctx = mp.get_context('spawn')
+        ps = []
+        for rank in range(world_size):
+            p = ctx.Process(target=f, args=(rank, world_size, init_pg))
+            p.start()
+            ps.append(p)
+
+        for p in ps:
+            p.join()
+            self.assertEqual(p.exitcode, 0)
+
+    @skipIfUnsupportMultiNPU(2)
+    def test_collective_stats(self):
+        self._test_multiprocess(CollectiveStatsTest._test_collective_stats,
+                                CollectiveStatsTest._init_dist_hccl, 2)
+
+
+if __name__ == '__main__':
+    run_tests()
@@ -53,6 +53,113 @@ class HcomAllReduceTest(TestCase):
         hook_grad = HcomAllReduceTest._get_grad(hook_model, train_data)
         TestCase().assertEqual(hook_grad, no_hook_grad)
 
+    @classmethod
+    def _test_builtin_hook(cls, rank, world_size, hook_type):
+        torch.npu.manual_seed(0)
+        torch.manual_seed(0)
+        pg = HcomAllReduceTest._init_dist_hccl(rank, world_size)
+        torch.npu.set_device(rank)
+        model = TestDdpCommHook().npu()
+        params = list(model.parameters())
+        reducer = torch_npu._C._distributed_c10d.Reducer(
+            params, [[0]], [params[0].numel() * params[0].element_size()], dist.distributed_c10d._get_default_group())
+        torch_npu.distributed._register_builtin_comm_hook(reducer, hook_type)
+
+        train_data = torch.full((40, 20), float(rank + 1)).npu()
+        output = model(train_data).sum()
+        reducer.prepare_for_backward([output])
+        output.backward()
+        torch.npu.synchronize()
+
+        # The gradient on each rank is train_data, so the averaged gradient is
+        # the mean of (rank + 1), which bf16 represents exactly for 2 ranks and
+        # int8 blocks reproduce up to fp32 rounding of the scales.
+        expected = torch.full((40, 20), (world_size + 1) / 2.0).npu()
+        TestCase().assertEqual(params[0].grad, expected, atol=1e-5, rtol=1e-5)
+
+    @skipIfUnsupportMultiNPU(2)
+    def test_builtin_bf16_compress_hook(self):
+        # CI currently supports only 2 devices
+        world_size = 2
+        mp.spawn(HcomAllReduceTest._test_builtin_hook,
+                 args=(world_size, torch_npu.distributed.BuiltinCommHookType.BF16_COMPRESS,),
+                 nprocs=world_size,
+                 join=True)
+
+    @skipIfUnsupportMultiNPU(2)
+    def test_builtin_blockwise_int8_compress_hook(self):
+        # CI currently supports only 2 devices
+        world_size = 2
+        for hook_type in [torch_npu.distributed.BuiltinCommHookType.BLOCKWISE_INT8_COMPRESS,
+                          torch_npu.distributed.BuiltinCommHookType.BLOCKWISE_INT8_COMPRESS_WITH_ERROR_FEEDBACK]:
+            mp.spawn(HcomAllReduceTest._test_builtin_hook,
+                     args=(world_size, hook_type,),
+                     nprocs=world_size,
+                     join=True)
+
+    @classmethod
+    def _test_powersgd_hook(cls, rank, world_size):
+        torch.npu.manual_seed(0)
+        torch.manual_seed(0)
+        HcomAllReduceTest._init_dist_hccl(rank, world_size)
+        torch.npu.set_device(rank)
+        model = TestDdpCommHook().npu()
+        params = list(model.parameters())
+        pg = dist.distributed_c10d._get_default_group()
+        reducer = torch_npu._C._distributed_c10d.Reducer(
+            params, [[0]], [params[0].numel() * params[0].element_size()], pg)
+        state = torch_npu.distributed._PowerSGDState(pg, matrix_approximation_rank=1, start_powerSGD_iter=2)
+        torch_npu.distributed._register_powersgd_comm_hook(reducer, state)
+
+        # A constant gradient has rank 1, so the rank-1 approximation is exact.
+        train_data = torch.full((40, 20), float(rank + 1)).npu()
+        expected = torch.full((40, 20), (world_size + 1) / 2.0).npu()
+        for _ in range(3):
+            params[0].grad = None
+            output = model(train_data).sum()
+            reducer.prepare_for_backward([output])
+            output.backward()
+            torch.npu.synchronize()
+            TestCase().assertEqual(params[0].grad, expected, atol=1e-4, rtol=1e-4)
+
+        state_dict = state.state_dict()
+        TestCase().assertEqual(state_dict["iter"].item(), 3)
+        TestCase().assertTrue("q_memory.0" in state_dict and "error.0" in state_dict)
+        restored = torch_npu.distributed._PowerSGDState(pg, matrix_approximation_rank=1, start_powerSGD_iter=2)
+        restored.load_state_dict(state_dict)
+        TestCase().assertEqual(restored.iter, 3)
+        TestCase().assertEqual(restored.state_dict()["q_memory.0"], state_dict["q_memory.0"])
+
+    @skipIfUnsupportMultiNPU(2)
+    def test_powersgd_hook(self):
+        # CI currently supports only 2 devices
+        world_size = 2
+        mp.spawn(HcomAllReduceTest._test_powersgd_hook,
+                 args=(world_size,),
+                 nprocs=world_size,
+                 join=True)
+
+    def test_blockwise_int8_quantize_cpu(self):
+        block_size = 64
+        data = torch.randn(block_size * 8)
+        data[:block_size] = 0
+        quantized, scales = torch_npu._C._distributed_c10d._blockwise_quantize_int8(data, block_size)
+        self.assertEqual(quantized.dtype, torch.int8)
+        self.assertEqual(scales.numel(), 8)
+
+        blocks = data.view(-1, block_size)
+        expected_scales = blocks.abs().amax(1) / 127
+        expected_quantized = torch.where(expected_scales[:, None] > 0, blocks / expected_scales[:, None],
+                                         torch.zeros_like(blocks)).round().clamp(-127, 127).to(torch.int8)
+        self.assertEqual(scales, expected_scales)
+        self.assertEqual(quantized, expected_quantized.view(-1))
+
+        restored = torch_npu._C._distributed_c10d._blockwise_dequantize_int8(quantized, scales, block_size)
+        # Rounding to the nearest level is off by at most half a quantization step per block.
+        max_error = (restored - data).abs().view(-1, block_size).amax(1)
+        self.assertTrue(bool((max_error <= scales / 2 + 1e-7).all()))
+        self.assertEqual(restored[:block_size], torch.zeros(block_size))
+
     @skipIfUnsupportMultiNPU(2)
     def test_fp16_compress_hook(self):
         # CI currently supports only 2 devices
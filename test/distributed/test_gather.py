@@ -36,6 +36,37 @@ class HcclGatherTest(TestCase):
             c2p.put((rank, dst, []))
         p2c.get()
 
+    @classmethod
+    def _test_gather_non_zero_dst(cls, test_data, world_size, init_pg, c2p, p2c):
+        rank, input1, output1 = test_data
+        pg = init_pg(rank, world_size)
+        dst = world_size - 1
+        input1 = (input1 + rank).npu()
+        output1 = [i.npu() for i in output1]
+        if rank == dst:
+            pg.gather(input1, output1, dst=dst)
+            c2p.put((rank, dst, [t.cpu() for t in output1]))
+        else:
+            pg.gather(input1, [], dst=dst)
+            c2p.put((rank, dst, []))
+        p2c.get()
+
+    @classmethod
+    def _test_gather_uneven(cls, test_data, world_size, init_pg, c2p, p2c):
+        rank, input1, output1 = test_data
+        pg = init_pg(rank, world_size)
+        dst = 0
+        # Rank r contributes r + 1 rows, the root sizes each slot to match.
+        input1 = (input1[:rank + 1] + rank).npu()
+        output1 = [i.npu() for i in output1]
+        if rank == dst:
+            pg.gather(input1, output1, dst=dst)
+            c2p.put((rank, dst, [t.cpu() for t in output1]))
+        else:
+            pg.gather(input1, [], dst=dst)
+            c2p.put((rank, dst, []))
+        p2c.get()
+
     @classmethod
     def _test_gather_object(cls, test_data, world_size, init_pg, c2p, p2c):
         rank, input1, output1 = test_data
@@ -68,7 +99,7 @@ class HcclGatherTest(TestCase):
 
         for _ in range(world_size):
             rank, dst, output = c2p.get()
-            if rank == 0:
+            if rank == dst:
                 for i, j in zip(output, expected):
                     self.assertEqual(i, j,
                                      ("rank {} Expect receive tensor {} but got {}.").format(rank, expected, output))
@@ -92,6 +123,32 @@ class HcclGatherTest(TestCase):
                 self._test_multiprocess(HcclGatherTest._test_gather,
                                         HcclGatherTest._init_dist_hccl, proc_data, rank)
 
+    @skipIfUnsupportMultiNPU(2)
+    def test_gather_non_zero_dst_dist(self):
+        ranks = [2]
+        dtypes = [torch.float32, torch.float16, torch.int32]
+        for rank in ranks:
+            for _dtype in dtypes:
+                _input = torch.ones([4, 16], dtype=_dtype)
+                _output = [torch.empty([4, 16], dtype=_dtype) for _ in range(rank)]
+                _expected = [torch.ones([4, 16], dtype=_dtype) + i for i in range(rank)]
+                proc_data = (_input, _output, _expected)
+                self._test_multiprocess(HcclGatherTest._test_gather_non_zero_dst,
+                                        HcclGatherTest._init_dist_hccl, proc_data, rank)
+
+    @skipIfUnsupportMultiNPU(2)
+    def test_gather_uneven_dist(self):
+        ranks = [2]
+        dtypes = [torch.float32, torch.float16, torch.int32]
+        for rank in ranks:
+            for _dtype in dtypes:
+                _input = torch.ones([rank, 16], dtype=_dtype)
+                _output = [torch.empty([i + 1, 16], dtype=_dtype) for i in range(rank)]
+                _expected = [torch.ones([i + 1, 16], dtype=_dtype) + i for i in range(rank)]
+                proc_data = (_input, _output, _expected)
+                self._test_multiprocess(HcclGatherTest._test_gather_uneven,
+                                        HcclGatherTest._init_dist_hccl, proc_data, rank)
+
     @skipIfUnsupportMultiNPU(2)
     def test_gather_object_dist(self):
         ranks = [2]
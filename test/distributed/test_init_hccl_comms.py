@@ -0,0 +1,66 @@
+import os
+
+import torch
+import torch.distributed as dist
+import torch.multiprocessing as mp
+import torch_npu
+from torch_npu.testing.common_distributed import skipIfUnsupportMultiNPU
+from torch_npu.testing.testcase import TestCase, run_tests
+
+
+class InitHcclCommsTest(TestCase):
+    @classmethod
+    def _init_dist_hccl(cls, rank, world_size):
+        os.environ['MASTER_ADDR'] = '127.0.0.1'
+        os.environ['MASTER_PORT'] = '29500'
+        os.environ['HCCL_WHITELIST_DISABLE'] = '1'
+        torch_npu.npu.set_device(rank)
+        dist.init_process_group(backend='hccl', world_size=world_size, rank=rank)
+        return dist
+
+    @classmethod
+    def _test_init_hccl_comms(cls, rank, world_size, init_pg, max_workers):
+        init_pg(rank, world_size)
+        groups = [dist.new_group() for _ in range(4)]
+        latencies = torch_npu.distributed.init_hccl_comms(groups, max_workers=max_workers)
+        assert list(latencies.keys()) == groups
+        assert all(latency > 0 for latency in latencies.values())
+        for group in groups:
+            backend = group._get_backend(torch.device('npu'))
+            assert backend.get_hccl_comm_name(rank, init_comm=False) != ""
+
+        # Communicators created above are reused, the default group is created now.
+        latencies = torch_npu.distributed.init_hccl_comms()
+        assert all(latencies[group] == 0.0 for group in groups)
+        assert latencies[dist.GroupMember.WORLD] > 0
+
+        tensor = torch.ones(2).npu()
+        for group in groups:
+            dist.all_reduce(tensor, group=group)
+        assert torch.equal(tensor.cpu(), torch.full((2,), float(world_size ** len(groups))))
+
+    def _test_multiprocess(self, f, init_pg, world_size, max_workers):
+        ctx = mp.get_context('spawn')
+        ps = []
+        for rank in range(world_size):
+            p = ctx.Process(target=f, args=(rank, world_size, init_pg, max_workers))
+            p.start()
+            ps.append(p)
+
+        for p in ps:
+            p.join()
+            self.assertEqual(p.exitcode, 0)
+
+    @skipIfUnsupportMultiNPU(2)
+    def test_init_hccl_comms(self):
+        self._test_multiprocess(InitHcclCommsTest._test_init_hccl_comms,
+                                InitHcclCommsTest._init_dist_hccl, 2, 0)
+
+    @skipIfUnsupportMultiNPU(2)
+    def test_init_hccl_comms_bounded_workers(self):
+        self._test_multiprocess(InitHcclCommsTest._test_init_hccl_comms,
+                                InitHcclCommsTest._init_dist_hccl, 2, 2)
+
+
+if __name__ == '__main__':
+    run_tests()
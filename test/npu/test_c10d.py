@@ -175,6 +175,39 @@ class ComputeBucketAssignmentTest(TestCase):
         expec_result = ([[0], [1], [2, 4], [3, 5], [6, 8], [7, 9]], [200, 200, 400, 400, 400, 400])
         self.assertEqual(expec_result, result)
 
+    def test_overlap_plan_single_ready_time(self):
+        tensors = [torch.empty([10], dtype=torch.float) for _ in range(4)]
+        plan = torch_npu._C._distributed_c10d._compute_bucket_assignment_by_overlap(
+            tensors, [0, 0, 0, 0], bucket_size_limit=1000, alpha_ns=1000, beta_ns_per_byte=1)
+        self.assertEqual([[0, 1, 2, 3]], plan["bucket_indices"])
+        self.assertEqual([160], plan["bucket_bytes"])
+        self.assertEqual([1160], plan["end_time_ns"])
+
+    def test_overlap_plan_staggered_ready_time(self):
+        tensors = [torch.empty([10], dtype=torch.float) for _ in range(4)]
+        plan = torch_npu._C._distributed_c10d._compute_bucket_assignment_by_overlap(
+            tensors, [0, 0, 10000, 10000], tensor_indices=[3, 2, 1, 0],
+            bucket_size_limit=1000, alpha_ns=100, beta_ns_per_byte=1)
+        # Launching the early gradients on their own hides their collective
+        # behind the remaining backward compute.
+        self.assertEqual([[3, 2], [1, 0]], plan["bucket_indices"])
+        self.assertEqual([0, 10000], plan["ready_time_ns"])
+        self.assertEqual([180, 10180], plan["end_time_ns"])
+
+    def test_overlap_plan_respects_size_limit(self):
+        tensors = [torch.empty([10], dtype=torch.float) for _ in range(4)]
+        plan = torch_npu._C._distributed_c10d._compute_bucket_assignment_by_overlap(
+            tensors, [0, 0, 0, 0], bucket_size_limit=80, alpha_ns=1000, beta_ns_per_byte=1)
+        self.assertEqual([[0, 1], [2, 3]], plan["bucket_indices"])
+
+    def test_overlap_plan_mixed_dtype_falls_back(self):
+        tensors = [
+            torch.empty([10], dtype=torch.float),
+            torch.empty([10], dtype=torch.half),
+        ]
+        plan = torch_npu._C._distributed_c10d._compute_bucket_assignment_by_overlap(tensors, [0, 0])
+        self.assertEqual([], plan["bucket_indices"])
+
 
 if __name__ == '__main__':
     run_tests()
@@ -7,6 +7,7 @@ class TestMstx(TestCase):
     mark_msg = ''
     range_msg = ''
     range_id = 0
+    domain_enable = {}
 
     def setUp(self):
         def stub_mark(message : str = ''):
@@ -30,6 +31,11 @@ class TestMstx(TestCase):
         torch_npu._C._mstx._range_start_on_host = stub_range_start_on_host
         torch_npu._C._mstx._range_end = stub_range_end
 
+        def stub_set_domain_enable(domain: str, enable: bool):
+            self.domain_enable[domain] = enable
+
+        torch_npu._C._mstx._set_domain_enable = stub_set_domain_enable
+
     def test_mark(self):
         torch_npu.npu.mstx.mark("test1")
         self.assertEqual("test1", self.mark_msg)
@@ -62,6 +68,16 @@ class TestMstx(TestCase):
         torch_npu.npu.mstx.range_end(1)
         self.assertEqual(1, self.range_id)
 
+    def test_set_domain_enabled(self):
+        self.domain_enable = {}
+        torch_npu.npu.mstx.set_domain_enabled("communication", False)
+        self.assertEqual({"communication": False}, self.domain_enable)
+        torch_npu.npu.mstx.set_domain_enabled("communication")
+        self.assertEqual({"communication": True}, self.domain_enable)
+        torch_npu.npu.mstx.set_domain_enabled("default", "no")
+        torch_npu.npu.mstx.set_domain_enabled(1, True)
+        self.assertEqual({"communication": True}, self.domain_enable)
+
 
 if __name__ == '__main__':
     run_tests()
\ No newline at end of file
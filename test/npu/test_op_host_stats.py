@@ -0,0 +1,82 @@
+import time
+
+import torch
+import torch_npu
+from torch_npu.testing.testcase import TestCase, run_tests
+
+
+class TestOpHostStats(TestCase):
+
+    def setUp(self):
+        self.was_enabled = torch.npu.is_op_host_stats_enabled()
+        torch.npu.set_op_host_stats_enabled(True)
+        torch.npu.op_host_stats(reset=True)
+
+    def tearDown(self):
+        torch.npu.set_op_host_stats_enabled(self.was_enabled)
+
+    def test_op_host_stats(self):
+        x = torch.randn(64, 64).npu()
+        for _ in range(10):
+            x = x + 1
+        torch.npu.synchronize()
+        stats = torch.npu.op_host_stats()
+        self.assertTrue(stats)
+        launched = [row for row in stats if row["launch"]["count"] > 0]
+        self.assertTrue(launched)
+        for row in launched:
+            launch = row["launch"]
+            self.assertLessEqual(launch["p50_us"], launch["p99_us"])
+            self.assertLessEqual(launch["p99_us"], launch["max_us"])
+            self.assertGreater(row["build"]["count"], 0)
+
+    def test_op_host_stats_reset(self):
+        x = torch.randn(8).npu()
+        (x * 2).sum()
+        torch.npu.synchronize()
+        self.assertTrue(torch.npu.op_host_stats(reset=True))
+        self.assertEqual(torch.npu.op_host_stats(), [])
+
+    def test_op_host_stats_disabled(self):
+        torch.npu.set_op_host_stats_enabled(False)
+        x = torch.randn(8).npu()
+        (x - 1).sum()
+        torch.npu.synchronize()
+        self.assertEqual(torch.npu.op_host_stats(), [])
+
+    def test_op_device_timing(self):
+        interval = torch.npu.get_op_device_timing_interval()
+        torch.npu.set_op_device_timing_interval(1)
+        try:
+            x = torch.randn(64, 64).npu()
+            for _ in range(10):
+                x = x * 2
+            torch.npu.synchronize()
+            # The device times are collected in the background.
+            timed = []
+            for _ in range(100):
+                timed = [row for row in torch.npu.op_host_stats() if row["device"]["count"] > 0]
+                if timed:
+                    break
+                time.sleep(0.01)
+            self.assertTrue(timed)
+            for row in timed:
+                device = row["device"]
+                self.assertLessEqual(device["count"], row["launch"]["count"])
+                self.assertLessEqual(device["p50_us"], device["max_us"])
+        finally:
+            torch.npu.set_op_device_timing_interval(interval)
+
+    def test_op_host_stats_invalid_args(self):
+        with self.assertRaises(TypeError):
+            torch.npu.set_op_host_stats_enabled(1)
+        with self.assertRaises(TypeError):
+            torch.npu.op_host_stats(reset="yes")
+        with self.assertRaises(TypeError):
+            torch.npu.set_op_device_timing_interval(1.5)
+        with self.assertRaises(ValueError):
+            torch.npu.set_op_device_timing_interval(-1)
+
+
+if __name__ == "__main__":
+    run_tests()
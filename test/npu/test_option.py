@@ -66,5 +66,21 @@ class TestOption(TestCase):
         option = {"FORCE_ACLNN_OP_LIST": "index"}
         self.assertIsNone(torch.npu.set_option(option))
 
+    def test_option_op_hook_sampling(self):
+        option = {"OP_HOOK_OP_LIST": "add,mul", "OP_HOOK_SAMPLE_INTERVAL": "4", "OP_HOOK_SAMPLE_RATE": "0.5"}
+        self.assertIsNone(torch.npu.set_option(option))
+        option = {"OP_HOOK_OP_LIST": "", "OP_HOOK_SAMPLE_INTERVAL": "1", "OP_HOOK_SAMPLE_RATE": "1"}
+        self.assertIsNone(torch.npu.set_option(option))
+
+    def test_option_op_hook_sample_interval(self):
+        option = {"OP_HOOK_SAMPLE_INTERVAL": "0"}
+        with self.assertRaises(ValueError):
+            torch.npu.set_option(option)
+
+    def test_option_op_hook_sample_rate(self):
+        for rate in ("0", "1.5", "half"):
+            with self.assertRaises(ValueError):
+                torch.npu.set_option({"OP_HOOK_SAMPLE_RATE": rate})
+
 if __name__ == "__main__":
     run_tests()
@@ -0,0 +1,73 @@
+import random
+import struct
+
+from torch_npu.profiler.analysis.prof_bean._memory_aggregate_bean import MemoryAggregateBean
+from torch_npu.profiler.analysis.prof_common_func._constant import Constant
+from torch_npu.testing.testcase import TestCase, run_tests
+
+
+class TestMemoryAggregateBean(TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        super().setUpClass()
+        cls.sample_num = 3
+        cls.npu_id = 20
+        cls.test_cases = [cls.generate_sample() for _ in range(cls.sample_num)]
+
+    @classmethod
+    def generate_sample(cls):
+        start_ns = random.randint(0, 2**62)
+        peak_ns = random.randint(start_ns, 2**63 - 2)
+        end_ns = random.randint(peak_ns + 1, 2**63 - 1)
+        stream_ptr = random.randint(0, 2**63 - 1)
+        alloc_bytes, free_bytes = random.randint(0, 2**63 - 1), random.randint(0, 2**63 - 1)
+        alloc_count, free_count = random.randint(0, 2**64 - 1), random.randint(0, 2**64 - 1)
+        peak = [random.randint(0, 2**63 - 1) for _ in range(3)]
+        total = [random.randint(0, 2**63 - 1) for _ in range(3)]
+        process_id = random.randint(0, 2**64 - 1)
+        device_type = random.choice([0, 20])
+        device_index = random.randint(-2**7, 2**7 - 1)
+        allocator_type = random.choice([0, 1])
+        sample = {
+            "data": struct.pack("<6q2Q6qQ2bB", start_ns, end_ns, peak_ns, stream_ptr, alloc_bytes, free_bytes,
+                                alloc_count, free_count, *peak, *total, process_id, device_type, device_index,
+                                allocator_type),
+            "stream_ptr": stream_ptr, "alloc_bytes": alloc_bytes, "free_bytes": free_bytes,
+            "alloc_count": alloc_count, "free_count": free_count, "peak": peak, "total": total,
+            "process_id": process_id, "dev_type": device_type, "dev_id": device_index,
+            "allocator_type": allocator_type, "is_npu": device_type == cls.npu_id
+        }
+        return sample
+
+    def test_property(self):
+        for test_case in self.test_cases:
+            bean = MemoryAggregateBean(test_case.get("data"))
+            self.assertEqual(test_case.get("stream_ptr"), bean.stream_ptr)
+            self.assertEqual(test_case.get("alloc_bytes"), bean.alloc_bytes)
+            self.assertEqual(test_case.get("free_bytes"), bean.free_bytes)
+            self.assertEqual(test_case.get("alloc_count"), bean.alloc_count)
+            self.assertEqual(test_case.get("free_count"), bean.free_count)
+            self.assertEqual(test_case.get("process_id"), bean.pid)
+            self.assertEqual(test_case.get("dev_type"), bean.device_type)
+            self.assertEqual(test_case.get("dev_id"), bean.device_index)
+            self.assertEqual(test_case.get("allocator_type"), bean.allocator_type)
+            self.assertEqual(test_case.get("is_npu"), bean.is_npu())
+            self.assertTrue(bean.has_peak())
+            total_allocated, total_reserved, total_active = test_case.get("total")
+            self.assertEqual(total_allocated, bean.total_allocated_for_db)
+            self.assertEqual(total_reserved / Constant.B_TO_MB, bean.total_reserved)
+            self.assertEqual(total_active, bean.total_active_for_db)
+
+    def test_peak_record(self):
+        for test_case in self.test_cases:
+            peak_bean = MemoryAggregateBean(test_case.get("data")).peak_record()
+            peak_allocated, peak_reserved, peak_active = test_case.get("peak")
+            self.assertEqual(peak_allocated, peak_bean.total_allocated_for_db)
+            self.assertEqual(peak_reserved, peak_bean.total_reserved_for_db)
+            self.assertEqual(peak_active / Constant.B_TO_MB, peak_bean.total_active)
+            self.assertEqual(test_case.get("stream_ptr"), peak_bean.stream_ptr)
+
+
+if __name__ == "__main__":
+    run_tests()
@@ -0,0 +1,42 @@
+import random
+import struct
+from torch_npu.profiler.analysis.prof_bean._python_sample_bean import PythonSampleBean
+from torch_npu.testing.testcase import TestCase, run_tests
+
+
+class TestPythonSampleBean(TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        super().setUpClass()
+        cls.sample_num = 3
+        cls.test_cases = [cls.generate_sample() for _ in range(cls.sample_num)]
+
+    @classmethod
+    def generate_sample(cls):
+        thread_id = random.randint(0, 2**64 - 1)
+        key = random.randint(0, 2**64 - 1)
+        count = random.randint(0, 2**64 - 1)
+        node_id = random.randint(1, 2**32 - 1)
+        parent_id = random.randint(0, node_id - 1)
+        interval_us = random.randint(1, 10**6)
+        sample = {
+            "data": struct.pack("<3Q3I", thread_id, key, count, node_id, parent_id, interval_us),
+            "thread_id": thread_id, "key": key, "count": count,
+            "node_id": node_id, "parent_id": parent_id, "interval_us": interval_us
+        }
+        return sample
+
+    def test_property(self):
+        for test_case in self.test_cases:
+            python_sample_bean = PythonSampleBean(test_case.get("data"))
+            self.assertEqual(test_case.get("thread_id"), python_sample_bean.tid)
+            self.assertEqual(test_case.get("key"), python_sample_bean.key)
+            self.assertEqual(test_case.get("count"), python_sample_bean.count)
+            self.assertEqual(test_case.get("node_id"), python_sample_bean.node_id)
+            self.assertEqual(test_case.get("parent_id"), python_sample_bean.parent_id)
+            self.assertEqual(test_case.get("interval_us"), python_sample_bean.interval_us)
+
+
+if __name__ == "__main__":
+    run_tests()
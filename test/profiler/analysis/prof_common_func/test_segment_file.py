@@ -0,0 +1,64 @@
+import os
+import shutil
+import struct
+from unittest import mock
+
+from torch_npu.profiler.analysis.prof_common_func._segment_file import SegmentFile
+from torch_npu.testing.testcase import TestCase, run_tests
+
+
+class TestSegmentFile(TestCase):
+
+    def setUp(self):
+        self.tmp_dir = "./segment_file_test"
+        os.makedirs(self.tmp_dir, exist_ok=True)
+        self.stored = b"torch.op_range"
+        # "abc" followed by a 10 byte match at offset 3 and 5 trailing literals.
+        self.lz4_payload = b"\x36abc\x03\x00\x50bcabc"
+        self.lz4_raw = b"abc" * 6
+        self.segments = [(8, 0, len(self.stored), len(self.stored)),
+                         (8 + 8 + len(self.stored), len(self.stored), len(self.lz4_payload), len(self.lz4_raw))]
+        data = struct.pack("<IHH", SegmentFile.FILE_MAGIC, 1, 1)
+        data += struct.pack("<II", len(self.stored), len(self.stored)) + self.stored
+        data += struct.pack("<II", len(self.lz4_payload), len(self.lz4_raw)) + self.lz4_payload
+        self.body = data
+        for segment in self.segments:
+            data += struct.pack("<QQII", *segment)
+        data += struct.pack("<QQII", len(self.body), len(self.segments), SegmentFile.INDEX_MAGIC, 0)
+        self.file_path = os.path.join(self.tmp_dir, "torch.op_range")
+        with open(self.file_path, "wb") as file:
+            file.write(data)
+
+    def tearDown(self):
+        shutil.rmtree(self.tmp_dir)
+
+    def test_read_with_index(self):
+        self.assertTrue(SegmentFile.is_segment_file(self.file_path))
+        reader = SegmentFile(self.file_path)
+        self.assertEqual(self.segments, reader.segments())
+        self.assertEqual(self.lz4_raw, reader.read_segment(1))
+        self.assertEqual(self.stored + self.lz4_raw, reader.read_all())
+
+    def test_read_without_index(self):
+        # A file that was not closed ends with the zeroed tail of its preallocated window.
+        with open(self.file_path, "wb") as file:
+            file.write(self.body + b"\x00" * 64)
+        reader = SegmentFile(self.file_path)
+        self.assertEqual(self.segments, reader.segments())
+        self.assertEqual(self.stored + self.lz4_raw, reader.read_all())
+
+    def test_builtin_lz4_decoder(self):
+        with mock.patch("torch_npu.profiler.analysis.prof_common_func._segment_file._lz4_block", None):
+            self.assertEqual(self.lz4_raw, SegmentFile.lz4_block_decompress(self.lz4_payload, len(self.lz4_raw)))
+            with self.assertRaises(RuntimeError):
+                SegmentFile.lz4_block_decompress(self.lz4_payload, len(self.lz4_raw) + 1)
+
+    def test_raw_file_is_not_segment_file(self):
+        raw_path = os.path.join(self.tmp_dir, "torch.op_mark")
+        with open(raw_path, "wb") as file:
+            file.write(struct.pack("<HIq", 1, 50, 111))
+        self.assertFalse(SegmentFile.is_segment_file(raw_path))
+
+
+if __name__ == "__main__":
+    run_tests()
@@ -45,6 +45,16 @@ class TestExperimentalConfig(TestCase):
         experimental_config = _ExperimentalConfig()
         self.assertTrue(isinstance(experimental_config(), Cpp_ExperimentalConfig))
 
+    def test_python_sample_interval_us(self):
+        self.assertEqual(10000, _ExperimentalConfig(python_sample_interval_us=10000)._python_sample_interval_us)
+        for interval in (-1, 1.5, True, Constant.MAX_PYTHON_SAMPLE_INTERVAL_US + 1):
+            self.assertEqual(0, _ExperimentalConfig(python_sample_interval_us=interval)._python_sample_interval_us)
+
+    def test_memory_aggregate_interval_us(self):
+        self.assertEqual(1000, _ExperimentalConfig(memory_aggregate_interval_us=1000)._memory_aggregate_interval_us)
+        for interval in (-1, 0.5, True, Constant.MAX_MEMORY_AGGREGATE_INTERVAL_US + 1):
+            self.assertEqual(0, _ExperimentalConfig(memory_aggregate_interval_us=interval)._memory_aggregate_interval_us)
+
 
 if __name__ == "__main__":
     run_tests()
@@ -57,6 +57,14 @@ class TestActionController(TestCase):
         with mock.patch(self.namespace + "._stop_profiler") as mock_stop:
             self.prof_if.stop_trace()
             mock_stop.assert_called_once()
+
+    def test_stop_trace_warns_dropped_records(self):
+        with mock.patch(self.namespace + "._stop_profiler"), \
+            mock.patch(self.namespace + "._get_dropped_records", return_value=3), \
+            mock.patch(self.namespace + ".print_warn_msg") as mock_warn:
+            self.prof_if.stop_trace()
+            mock_warn.assert_called_once()
+            self.assertIn("3 framework records were dropped", mock_warn.call_args[0][0])
     
     def test_finalize_trace(self):
         with mock.patch(self.namespace + "._init_profiler"), \
@@ -1603,6 +1603,24 @@ class TestNpuComm(TestCase):
     def test_gather_neg_dim(self):
         self._test_gather(-1)
 
+    @unittest.skipIf(not TEST_MULTINPU, "only one NPU detected")
+    def test_scatter_gather_round_trip_on_side_streams(self):
+        # scatter and gather order their peer copies with events instead of host
+        # synchronization, so back-to-back iterations on side streams must still
+        # observe the values written by the previous kernel on the source stream.
+        devices = [0, 1]
+        streams = [torch_npu.npu.Stream(device=d) for d in devices]
+        for dim in (0, 1):
+            for step in range(3):
+                x = torch.arange(8 * 6, dtype=torch.float, device=0).view(8, 6).add_(step)
+                chunks = comm.scatter(x, devices, dim=dim, streams=streams)
+                for stream in streams:
+                    torch_npu.npu.current_stream(stream.device).wait_stream(stream)
+                for d, chunk in zip(devices, chunks):
+                    self.assertEqual(chunk.device, torch.device('npu', d))
+                gathered = comm.gather(chunks, dim=dim, destination=0)
+                self.assertEqual(gathered, x, atol=0, rtol=0)
+
     @unittest.skipIf(not TEST_MULTINPU, "only one NPU detected")
     def test_memory_format_scatter_gather(self):
         nhwc = torch.randn((10, 3, 32, 32), device='cpu').contiguous(memory_format=torch.channels_last)
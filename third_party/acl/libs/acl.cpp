@@ -3,6 +3,24 @@
 #include "acl/acl_base.h"
 #include "acl/acl_mdl.h"
 
+#include <stdlib.h>
+#include <time.h>
+
+// Events carry the host time of their last record, so that elapsed times are
+// synthetic but consistent.
+struct StubEvent {
+    uint64_t recordNs;
+};
+
+static aclError StubCreateEvent(aclrtEvent *event)
+{
+    if (event == nullptr) {
+        return 0;
+    }
+    *event = calloc(1, sizeof(StubEvent));
+    return 0;
+}
+
 extern "C" {
 // 资源初始化，申请与释放
 aclError aclInit(const char *configPath){return 0;}
@@ -31,13 +49,34 @@ aclError aclrtSynchronizeStreamWithTimeout(aclrtStream stream, int32_t timeout){
 
 // Event
 aclError aclrtQueryEvent(aclrtEvent event, aclrtEventStatus *status){return 0;}
-aclError aclrtQueryEventStatus(aclrtEvent event, aclrtEventRecordedStatus *status){return 0;}
-aclError aclrtCreateEvent(aclrtEvent *event){return 0;}
-aclError aclrtDestroyEvent(aclrtEvent event){return 0;}
-aclError aclrtRecordEvent(aclrtEvent event, aclrtStream stream){return 0;}
+aclError aclrtQueryEventStatus(aclrtEvent event, aclrtEventRecordedStatus *status)
+{
+    if (status != nullptr) {
+        *status = ACL_EVENT_RECORDED_STATUS_COMPLETE;
+    }
+    return 0;
+}
+aclError aclrtCreateEvent(aclrtEvent *event){return StubCreateEvent(event);}
+aclError aclrtDestroyEvent(aclrtEvent event){free(event); return 0;}
+aclError aclrtRecordEvent(aclrtEvent event, aclrtStream stream)
+{
+    struct timespec now;
+    if (event != nullptr && clock_gettime(CLOCK_MONOTONIC, &now) == 0) {
+        static_cast<StubEvent *>(event)->recordNs = static_cast<uint64_t>(now.tv_sec) * 1000000000ULL + now.tv_nsec;
+    }
+    return 0;
+}
 aclError aclrtStreamWaitEvent(aclrtStream stream, aclrtEvent event){return 0;}
 aclError aclrtSynchronizeEvent(aclrtEvent event){return 0;}
-aclError aclrtEventElapsedTime(float *ms, aclrtEvent start, aclrtEvent end){return 0;}
+aclError aclrtEventElapsedTime(float *ms, aclrtEvent start, aclrtEvent end)
+{
+    if (ms != nullptr && start != nullptr && end != nullptr) {
+        uint64_t startNs = static_cast<StubEvent *>(start)->recordNs;
+        uint64_t endNs = static_cast<StubEvent *>(end)->recordNs;
+        *ms = endNs > startNs ? static_cast<float>(endNs - startNs) / 1000000 : 0;
+    }
+    return 0;
+}
 
 // memory相关操作
 aclError aclrtMalloc(void **devPtr, size_t size, aclrtMemMallocPolicy policy){return 0;}
@@ -89,8 +128,8 @@ aclError aclrtGetDeviceUtilizationRate(int32_t deviceId, aclrtUtilizationInfo *u
 
 void aclAppLog(aclLogLevel logLevel, const char *func, const char *file, uint32_t line, const char *fmt, ...) {}
 aclError aclrtSetExceptionInfoCallback(aclrtExceptionInfoCallback callback) {return 0;}
-aclError aclrtCreateEventWithFlag(aclrtEvent *event, uint32_t flag) {return 0;}
-aclError aclrtCreateEventExWithFlag(aclrtEvent *event, uint32_t flag) {return 0;}
+aclError aclrtCreateEventWithFlag(aclrtEvent *event, uint32_t flag) {return StubCreateEvent(event);}
+aclError aclrtCreateEventExWithFlag(aclrtEvent *event, uint32_t flag) {return StubCreateEvent(event);}
 aclError aclrtResetEvent(aclrtEvent event, aclrtStream stream){return 0;}
 aclError aclrtStreamQuery(aclrtStream stream, aclrtStreamStatus *status) {return 0;};
 }
@@ -119,6 +119,9 @@ class ModelState {
 public:
     void set_call_state(CallStateMode mode)
     {
+        if (mode == CallStateMode::L_BACKWARD && call_state_mode != CallStateMode::L_BACKWARD) {
+            backward_step++;
+        }
         call_state_mode = mode;
     }
 
@@ -127,6 +130,13 @@ public:
         return call_state_mode;
     }
 
+    // Number of times the model entered backward, used as the step counter by
+    // checks that only run on some steps.
+    uint64_t get_backward_step()
+    {
+        return backward_step;
+    }
+
     void set_model_mode(ModelMode mode)
     {
         model_mode = mode;
@@ -140,6 +150,7 @@ public:
 private:
     CallStateMode call_state_mode = CallStateMode::L_UNKNOW;
     ModelMode model_mode = ModelMode::L_UNKNOW;
+    uint64_t backward_step = 0;
 };
 
 C10_NPU_API inline ModelState& model_state()
@@ -50,6 +50,8 @@ struct QueueParas {
   void* paramVal = nullptr;
   static std::atomic<uint64_t> g_correlation_id;
   uint64_t correlation_id = 0;
+  // Host time of enqueue, set only when op host stats are enabled.
+  uint64_t enqueue_time_ns = 0;
 };
 
 aclError LaunchAsyncCopyTask(void* dst, size_t dstLen, void* src, size_t srcLen, aclrtMemcpyKind kind);
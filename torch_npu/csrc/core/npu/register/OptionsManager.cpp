@@ -276,6 +276,38 @@ uint32_t OptionsManager::GetStatusSaveInterval()
     return status_save_interval;
 }
 
+bool OptionsManager::CheckCollectiveStatsEnable()
+{
+    const static bool CheckCollectiveStatsEnable = []() -> bool {
+        int32_t collective_stats_enable = OptionsManager::GetBoolTypeOption("TORCH_HCCL_COLLECTIVE_STATS");
+        return collective_stats_enable != 0;
+    }();
+    return CheckCollectiveStatsEnable;
+}
+
+bool OptionsManager::CheckOpHostStatsEnable()
+{
+    const static bool CheckOpHostStatsEnable = []() -> bool {
+        int32_t op_host_stats_enable = OptionsManager::GetBoolTypeOption("OP_HOST_STATS_ENABLE");
+        return op_host_stats_enable != 0;
+    }();
+    return CheckOpHostStatsEnable;
+}
+
+uint32_t OptionsManager::GetOpDeviceTimingInterval()
+{
+    const static uint32_t op_device_timing_interval = []() -> uint32_t {
+        char* env_val = std::getenv("OP_DEVICE_TIMING_INTERVAL");
+        int64_t envFlag = (env_val != nullptr) ? strtol(env_val, nullptr, 10) : 0;
+        if (envFlag < 0 || envFlag > UINT32_MAX) {
+            envFlag = 0;
+            TORCH_NPU_WARN_ONCE("Get env OP_DEVICE_TIMING_INTERVAL out of range, so device timing is disabled.");
+        }
+        return static_cast<uint32_t>(envFlag);
+    }();
+    return op_device_timing_interval;
+}
+
 uint32_t OptionsManager::GetNslbCntVal()
 {
     const static uint32_t nslb_val = []() -> uint32_t {
@@ -449,6 +481,30 @@ std::pair<double, double> OptionsManager::GetSilenceSigmaThresh()
     return sigma_thresh;
 }
 
+uint32_t OptionsManager::GetSilenceCheckInterval()
+{
+    const static uint32_t check_interval = []() -> uint32_t {
+        char* buf_val = std::getenv("NPU_ASD_CHECK_INTERVAL");
+        // Default 1, every backward step is checked
+        int64_t interval = (buf_val != nullptr) ? strtol(buf_val, nullptr, 10) : 1;
+        TORCH_CHECK(interval > 0, "NPU_ASD_CHECK_INTERVAL should be positive.", PTA_ERROR(ErrCode::VALUE));
+        return static_cast<uint32_t>(interval);
+    }();
+    return check_interval;
+}
+
+double OptionsManager::GetSilenceCheckSampleRatio()
+{
+    const static double sample_ratio = []() -> double {
+        char* buf_val = std::getenv("NPU_ASD_SAMPLE_RATIO");
+        // Default 1.0, every collective input of a checked step is checked
+        double ratio = (buf_val != nullptr) ? strtod(buf_val, nullptr) : 1.0;
+        TORCH_CHECK(ratio > 0 && ratio <= 1, "NPU_ASD_SAMPLE_RATIO should be in (0, 1].", PTA_ERROR(ErrCode::VALUE));
+        return ratio;
+    }();
+    return sample_ratio;
+}
+
 uint32_t OptionsManager::GetHcclBufferSize()
 {
     const static uint32_t hccl_buf_size = []() -> uint32_t {
@@ -473,6 +529,18 @@ uint32_t OptionsManager::GetP2PBufferSize()
     return buf_size;
 }
 
+uint32_t OptionsManager::GetHcclCoalescedBucketCap()
+{
+    const static uint32_t bucket_cap = []() -> uint32_t {
+        char* buf_val = std::getenv("TORCH_HCCL_COALESCED_BUCKET_CAP_MB");
+        // Default 0M, fused allreduce_coalesced is disabled
+        int64_t bucket_cap = (buf_val != nullptr) ? strtol(buf_val, nullptr, 10) : 0;
+        TORCH_CHECK(bucket_cap >= 0, "TORCH_HCCL_COALESCED_BUCKET_CAP_MB cannot be negative.", PTA_ERROR(ErrCode::VALUE));
+        return static_cast<uint32_t>(bucket_cap);
+    }();
+    return bucket_cap;
+}
+
 uint32_t OptionsManager::GetAclOpInitMode()
 {
     const static uint32_t acl_op_init_mode = []() -> uint32_t {
@@ -108,6 +108,9 @@ public:
     static bool CheckStatusSaveEnable();
     static std::string GetStatusSavePath();
     static uint32_t GetStatusSaveInterval();
+    static bool CheckCollectiveStatsEnable();
+    static bool CheckOpHostStatsEnable();
+    static uint32_t GetOpDeviceTimingInterval();
     static uint32_t GetNslbCntVal();
     static bool CheckGeInitDisable();
     static bool CheckPerfDumpEnable();
@@ -116,8 +119,11 @@ public:
     static uint32_t GetSilenceCheckFlag();
     static std::pair<double, double> GetSilenceUpperThresh();
     static std::pair<double, double> GetSilenceSigmaThresh();
+    static uint32_t GetSilenceCheckInterval();
+    static double GetSilenceCheckSampleRatio();
     static uint32_t GetHcclBufferSize();
     static uint32_t GetP2PBufferSize();
+    static uint32_t GetHcclCoalescedBucketCap();
     static uint32_t GetTaskQueueEnable();
     static uint32_t GetAclOpInitMode();
     static char* GetCpuAffinityConf();
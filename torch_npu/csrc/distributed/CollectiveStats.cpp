@@ -0,0 +1,163 @@
+#include <algorithm>
+#include <cmath>
+
+#include "torch_npu/csrc/distributed/CollectiveStats.hpp"
+
+namespace c10d_npu {
+
+namespace {
+
+int latencyBucket(double latencyUs)
+{
+    if (latencyUs < 1.0) {
+        return 0;
+    }
+    int bucket = static_cast<int>(std::log2(latencyUs) * CollectiveStatsEntry::kBucketsPerOctave);
+    return std::min(bucket, CollectiveStatsEntry::kLatencyBuckets - 1);
+}
+
+} // namespace
+
+void CollectiveStatsEntry::add(uint64_t workBytes, double latencyUs)
+{
+    if (count == 0) {
+        minUs = latencyUs;
+        maxUs = latencyUs;
+    } else {
+        minUs = std::min(minUs, latencyUs);
+        maxUs = std::max(maxUs, latencyUs);
+    }
+    count++;
+    bytes += workBytes;
+    totalUs += latencyUs;
+    latencyHistogram[latencyBucket(latencyUs)]++;
+}
+
+double CollectiveStatsEntry::percentileUs(double q) const
+{
+    if (count == 0) {
+        return 0;
+    }
+    // Rank of the requested sample, 1-based.
+    auto rank = static_cast<uint64_t>(std::ceil(q * static_cast<double>(count)));
+    rank = std::max<uint64_t>(rank, 1);
+    uint64_t seen = 0;
+    for (int bucket = 0; bucket < kLatencyBuckets; ++bucket) {
+        seen += latencyHistogram[bucket];
+        if (seen >= rank) {
+            // Geometric middle of the bucket, clamped to the observed range.
+            double mid = std::exp2((bucket + 0.5) / kBucketsPerOctave);
+            return std::min(std::max(mid, minUs), maxUs);
+        }
+    }
+    return maxUs;
+}
+
+void CollectiveStats::record(c10d::OpType opType, at::ScalarType dtype, uint64_t bytes, double latencyUs)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_[std::make_tuple(opType, dtype, sizeBucket(bytes))].add(bytes, latencyUs);
+}
+
+std::vector<CollectiveStatsRow> CollectiveStats::snapshot(int worldSize) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<CollectiveStatsRow> rows;
+    rows.reserve(entries_.size());
+    for (const auto& kv : entries_) {
+        const auto& entry = kv.second;
+        CollectiveStatsRow row;
+        row.opType = opTypeToString(std::get<0>(kv.first));
+        row.dtype = c10::toString(std::get<1>(kv.first));
+        row.sizeBucketBytes = std::get<2>(kv.first);
+        row.count = entry.count;
+        row.bytes = entry.bytes;
+        row.avgUs = entry.count > 0 ? entry.totalUs / static_cast<double>(entry.count) : 0;
+        row.minUs = entry.minUs;
+        row.maxUs = entry.maxUs;
+        row.p50Us = entry.percentileUs(0.5);
+        row.p90Us = entry.percentileUs(0.9);
+        row.p99Us = entry.percentileUs(0.99);
+        // bytes / us == MB/s, so divide by 1e3 for GB/s.
+        row.algBandwidthGBps = entry.totalUs > 0 ? static_cast<double>(entry.bytes) / entry.totalUs / 1e3 : 0;
+        row.busBandwidthGBps = row.algBandwidthGBps * busBandwidthFactor(std::get<0>(kv.first), worldSize);
+        rows.push_back(std::move(row));
+    }
+    return rows;
+}
+
+void CollectiveStats::reset()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+}
+
+bool CollectiveStats::fitLatencyModel(c10d::OpType opType, double& alphaUs, double& betaUsPerByte) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    double sumW = 0;
+    double sumX = 0;
+    double sumY = 0;
+    double sumXX = 0;
+    double sumXY = 0;
+    for (const auto& kv : entries_) {
+        const auto& entry = kv.second;
+        if (std::get<0>(kv.first) != opType || entry.count == 0) {
+            continue;
+        }
+        const double w = static_cast<double>(entry.count);
+        const double x = static_cast<double>(entry.bytes) / w;
+        const double y = entry.totalUs / w;
+        sumW += w;
+        sumX += w * x;
+        sumY += w * y;
+        sumXX += w * x * x;
+        sumXY += w * x * y;
+    }
+    // Zero, up to rounding, when all samples have the same size.
+    const double denom = sumW * sumXX - sumX * sumX;
+    if (sumW == 0 || denom <= 1e-9 * sumW * sumXX) {
+        return false;
+    }
+    const double beta = (sumW * sumXY - sumX * sumY) / denom;
+    if (!(beta > 0)) {
+        return false;
+    }
+    alphaUs = std::max((sumY - beta * sumX) / sumW, 0.0);
+    betaUsPerByte = beta;
+    return true;
+}
+
+double CollectiveStats::busBandwidthFactor(c10d::OpType opType, int worldSize)
+{
+    if (worldSize <= 1) {
+        return 1.0;
+    }
+    const double n = static_cast<double>(worldSize);
+    switch (opType) {
+        case c10d::OpType::ALLREDUCE:
+        case c10d::OpType::ALLREDUCE_COALESCED:
+            return 2.0 * (n - 1) / n;
+        case c10d::OpType::ALLGATHER:
+        case c10d::OpType::_ALLGATHER_BASE:
+        case c10d::OpType::ALLGATHER_COALESCED:
+        case c10d::OpType::REDUCE_SCATTER:
+        case c10d::OpType::_REDUCE_SCATTER_BASE:
+        case c10d::OpType::ALLTOALL:
+        case c10d::OpType::ALLTOALL_BASE:
+            return (n - 1) / n;
+        default:
+            return 1.0;
+    }
+}
+
+uint64_t CollectiveStats::sizeBucket(uint64_t bytes)
+{
+    uint64_t bucket = 1;
+    while (bucket < bytes) {
+        bucket <<= 1;
+    }
+    return bucket;
+}
+
+} // namespace c10d_npu
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <c10/core/ScalarType.h>
+#include <c10d/Work.hpp>
+
+namespace c10d_npu {
+
+// Latency distribution and traffic of one (op type, dtype, size bucket) entry.
+// Latencies go into a log-scale histogram with kBucketsPerOctave buckets per
+// power of two, starting at 1us, so percentiles are accurate to about 19%.
+struct CollectiveStatsEntry {
+    static constexpr int kBucketsPerOctave = 4;
+    static constexpr int kLatencyBuckets = 24 * kBucketsPerOctave;
+
+    uint64_t count = 0;
+    uint64_t bytes = 0;
+    double totalUs = 0;
+    double minUs = 0;
+    double maxUs = 0;
+    std::array<uint64_t, kLatencyBuckets> latencyHistogram{};
+
+    void add(uint64_t workBytes, double latencyUs);
+
+    // Approximate q-quantile (0 <= q <= 1) of the recorded latencies in us.
+    double percentileUs(double q) const;
+};
+
+// One row of CollectiveStats::snapshot().
+struct CollectiveStatsRow {
+    std::string opType;
+    std::string dtype;
+    // Messages of this row are in (sizeBucketBytes / 2, sizeBucketBytes].
+    uint64_t sizeBucketBytes = 0;
+    uint64_t count = 0;
+    uint64_t bytes = 0;
+    double avgUs = 0;
+    double minUs = 0;
+    double maxUs = 0;
+    double p50Us = 0;
+    double p90Us = 0;
+    double p99Us = 0;
+    // Achieved algorithm and bus bandwidth in GB/s, following the nccl-tests
+    // conventions for the bus bandwidth factor of each collective.
+    double algBandwidthGBps = 0;
+    double busBandwidthGBps = 0;
+};
+
+// Per process group table of completed collectives, fed by the watchdog and
+// read from Python. All methods are thread safe.
+class CollectiveStats {
+public:
+    void record(c10d::OpType opType, at::ScalarType dtype, uint64_t bytes, double latencyUs);
+
+    std::vector<CollectiveStatsRow> snapshot(int worldSize) const;
+
+    void reset();
+
+    // Least squares fit of latency = alpha + beta * bytes over the entries of
+    // opType, each weighted by its sample count. Returns false unless at least
+    // two message sizes were recorded and the fit has a positive slope.
+    bool fitLatencyModel(c10d::OpType opType, double& alphaUs, double& betaUsPerByte) const;
+
+    // Bus bandwidth = algorithm bandwidth * factor, see nccl-tests PERFORMANCE.md.
+    static double busBandwidthFactor(c10d::OpType opType, int worldSize);
+
+    // Smallest power of two that is >= bytes, 1 for empty messages.
+    static uint64_t sizeBucket(uint64_t bytes);
+
+private:
+    using Key = std::tuple<c10d::OpType, at::ScalarType, uint64_t>;
+
+    mutable std::mutex mutex_;
+    std::map<Key, CollectiveStatsEntry> entries_;
+};
+
+} // namespace c10d_npu
@@ -20,6 +20,7 @@
 #include "torch_npu/csrc/distributed/rpc/init.h"
 #include "torch_npu/csrc/distributed/ProcessGroupHCCL.hpp"
 #include "torch_npu/csrc/distributed/reducer.hpp"
+#include "torch_npu/csrc/distributed/powersgd_comm_hook.hpp"
 #include "torch_npu/csrc/distributed/Init.h"
 #include "torch_npu/csrc/distributed/ParallelTcpStore.hpp"
 #include "torch_npu/csrc/aten/NPUNativeFunctions.h"
@@ -197,6 +198,34 @@ void _register_builtin_comm_hook(
     reducer.register_builtin_comm_hook(comm_hook_type);
 }
 
+// Same as above for the built-in hooks that are only provided by torch_npu.
+void _register_npu_builtin_comm_hook(
+    c10d_npu::Reducer& reducer,
+    c10d_npu::BuiltinCommHookType comm_hook_type) {
+    reducer.register_builtin_comm_hook(comm_hook_type);
+}
+
+// Registers the native PowerSGD hook. The state stays owned by Python as well so
+// that it can be checkpointed with state_dict() / load_state_dict().
+void _register_powersgd_comm_hook(
+    c10d_npu::Reducer& reducer,
+    std::shared_ptr<c10d_npu::PowerSGDState> state) {
+    reducer.register_comm_hook(std::make_unique<c10d_npu::PowerSGDCommHook>(std::move(state)));
+}
+
+py::dict bucket_plan_to_dict(const c10d_npu::BucketPlan& plan) {
+    py::dict result;
+    result["bucket_indices"] = plan.bucket_indices;
+    result["bucket_bytes"] = plan.bucket_bytes;
+    result["ready_time_ns"] = plan.ready_time_ns;
+    result["comm_time_ns"] = plan.comm_time_ns;
+    result["end_time_ns"] = plan.end_time_ns;
+    result["alpha_ns"] = plan.alpha_ns;
+    result["beta_ns_per_byte"] = plan.beta_ns_per_byte;
+    result["cost_from_stats"] = plan.cost_from_stats;
+    return result;
+}
+
 PyObject* c10d_npu_init(PyObject* _unused, PyObject* noargs) {
     auto torch_npu_C_module = THPObjectPtr(PyImport_ImportModule("torch_npu._C"));
     if (!torch_npu_C_module) {
@@ -228,6 +257,23 @@ PyObject* c10d_npu_init(PyObject* _unused, PyObject* noargs) {
         py::arg("logger") = c10::optional<std::shared_ptr<::c10d::Logger>>{},
         py::call_guard<py::gil_scoped_release>());
 
+    module.def("_compute_bucket_assignment_by_overlap",
+        [](const std::vector<at::Tensor>& tensors,
+        const std::vector<int64_t>& ready_time_ns,
+        const std::vector<int64_t>& tensor_indices,
+        size_t bucket_size_limit,
+        double alpha_ns,
+        double beta_ns_per_byte) {
+            return bucket_plan_to_dict(::c10d_npu::compute_bucket_assignment_by_overlap(
+                tensors, ready_time_ns, tensor_indices, bucket_size_limit, alpha_ns, beta_ns_per_byte));
+        },
+        py::arg("tensors"),
+        py::arg("ready_time_ns"),
+        py::arg("tensor_indices") = std::vector<int64_t>(),
+        py::arg("bucket_size_limit") = ::c10d_npu::kDefaultBucketBytesCap,
+        py::arg("alpha_ns") = ::c10d_npu::kDefaultBucketPlanAlphaUs * 1000,
+        py::arg("beta_ns_per_byte") = 1.0 / ::c10d_npu::kDefaultBucketPlanBandwidthGBps);
+
     module.def("_verify_params_across_processes",
         [](const c10::intrusive_ptr<::c10d::ProcessGroup>& process_group,
         const std::vector<at::Tensor>& params,
@@ -254,7 +300,62 @@ PyObject* c10d_npu_init(PyObject* _unused, PyObject* noargs) {
         .def("_register_builtin_comm_hook",
             &_register_builtin_comm_hook,
              py::arg("reducer"),
-             py::arg("comm_hook_type"));
+             py::arg("comm_hook_type"))
+        .def("_register_builtin_comm_hook",
+            &_register_npu_builtin_comm_hook,
+             py::arg("reducer"),
+             py::arg("comm_hook_type"))
+        .def("_register_powersgd_comm_hook",
+            &_register_powersgd_comm_hook,
+             py::arg("reducer"),
+             py::arg("state"));
+
+    shared_ptr_class_<c10d_npu::PowerSGDState>(module, "_PowerSGDState")
+        .def(py::init<
+               c10::intrusive_ptr<::c10d::ProcessGroup>,
+               int64_t,
+               int64_t,
+               double,
+               bool,
+               bool,
+               int64_t>(),
+             py::arg("process_group"),
+             py::arg("matrix_approximation_rank") = 1,
+             py::arg("start_powerSGD_iter") = 1000,
+             py::arg("min_compression_rate") = 2,
+             py::arg("use_error_feedback") = true,
+             py::arg("warm_start") = true,
+             py::arg("random_seed") = 0)
+        .def_readonly("matrix_approximation_rank", &c10d_npu::PowerSGDState::matrix_approximation_rank)
+        .def_readonly("start_powerSGD_iter", &c10d_npu::PowerSGDState::start_powerSGD_iter)
+        .def_readonly("min_compression_rate", &c10d_npu::PowerSGDState::min_compression_rate)
+        .def_readonly("use_error_feedback", &c10d_npu::PowerSGDState::use_error_feedback)
+        .def_readonly("warm_start", &c10d_npu::PowerSGDState::warm_start)
+        .def_readonly("random_seed", &c10d_npu::PowerSGDState::random_seed)
+        .def_readonly("iter", &c10d_npu::PowerSGDState::iter)
+        .def("state_dict", &c10d_npu::PowerSGDState::state_dict)
+        .def("load_state_dict", &c10d_npu::PowerSGDState::load_state_dict, py::arg("state"));
+
+    py::enum_<c10d_npu::BuiltinCommHookType>(module, "BuiltinCommHookType", R"(
+An enum-like class for built-in communication hooks provided by torch_npu: ``BF16_COMPRESS``,
+``BLOCKWISE_INT8_COMPRESS`` and ``BLOCKWISE_INT8_COMPRESS_WITH_ERROR_FEEDBACK``.)")
+        .value("BF16_COMPRESS", c10d_npu::BuiltinCommHookType::BF16_COMPRESS)
+        .value("BLOCKWISE_INT8_COMPRESS", c10d_npu::BuiltinCommHookType::BLOCKWISE_INT8_COMPRESS)
+        .value("BLOCKWISE_INT8_COMPRESS_WITH_ERROR_FEEDBACK",
+            c10d_npu::BuiltinCommHookType::BLOCKWISE_INT8_COMPRESS_WITH_ERROR_FEEDBACK);
+
+    module.def("_blockwise_quantize_int8",
+        &c10d_npu::blockwise_quantize_int8,
+        py::arg("input"),
+        py::arg("block_size") = c10d_npu::kDefaultQuantBlockSize,
+        py::call_guard<py::gil_scoped_release>());
+
+    module.def("_blockwise_dequantize_int8",
+        &c10d_npu::blockwise_dequantize_int8,
+        py::arg("quantized"),
+        py::arg("scales"),
+        py::arg("block_size") = c10d_npu::kDefaultQuantBlockSize,
+        py::call_guard<py::gil_scoped_release>());
 
     module.def("_broadcast_coalesced",
         // Define a lambda such that the pybind11 prototype can take a std::vector
@@ -276,6 +377,12 @@ PyObject* c10d_npu_init(PyObject* _unused, PyObject* noargs) {
 
     module.def("_is_support_hccl_comm_name", &c10d_npu::isSupportHcclCommName);
 
+    module.def("_init_hccl_comms",
+        &::c10d_npu::ProcessGroupHCCL::initHcclComms,
+        py::arg("groups"),
+        py::arg("max_workers") = 0,
+        py::call_guard<py::gil_scoped_release>());
+
     shared_ptr_class_<c10d_npu::Reducer>(module, "Reducer")
         .def(py::init<
                std::vector<at::Tensor>,
@@ -310,7 +417,19 @@ PyObject* c10d_npu_init(PyObject* _unused, PyObject* noargs) {
             [](c10d_npu::Reducer& reducer, const at::Tensor& output)
                 -> void { reducer.prepare_for_backward({output}); },
              py::call_guard<py::gil_scoped_release>())
-        .def("get_backward_stats", &c10d_npu::Reducer::get_backward_stats)
+        .def("get_backward_stats",
+            [](const c10d_npu::Reducer& reducer, bool with_bucket_plan) -> py::object {
+                auto stats = py::cast(reducer.get_backward_stats());
+                if (!with_bucket_plan) {
+                    return stats;
+                }
+                return py::make_tuple(stats, bucket_plan_to_dict(reducer.get_bucket_plan()));
+            },
+            py::arg("with_bucket_plan") = false)
+        .def("_get_bucket_plan",
+            [](const c10d_npu::Reducer& reducer) {
+                return bucket_plan_to_dict(reducer.get_bucket_plan());
+            })
         .def("_install_post_backward_futures", [](::c10d_npu::Reducer& reducer, const std::vector<std::shared_ptr<torch::jit::PythonFutureWrapper>>& futs) {
                 c10::List<c10::intrusive_ptr<c10::ivalue::Future>> futures(c10::FutureType::create(c10::TensorType::get()));
                 for (const auto &fut : futs) {
@@ -402,6 +521,41 @@ PyObject* c10d_npu_init(PyObject* _unused, PyObject* noargs) {
                 }
                 return pg.getHcclCommName(rankid, init_comm);
             })
+        .def("set_collective_stats_enabled", &::c10d_npu::ProcessGroupHCCL::setCollectiveStatsEnabled,
+             py::arg("enabled"))
+        .def("is_collective_stats_enabled", &::c10d_npu::ProcessGroupHCCL::isCollectiveStatsEnabled)
+        .def("get_collective_stats",
+            [](::c10d_npu::ProcessGroupHCCL &pg) -> py::list {
+                py::list stats;
+                for (const auto& row : pg.getCollectiveStats()) {
+                    py::dict entry;
+                    entry["op_type"] = row.opType;
+                    entry["dtype"] = row.dtype;
+                    entry["size_bucket_bytes"] = row.sizeBucketBytes;
+                    entry["count"] = row.count;
+                    entry["bytes"] = row.bytes;
+                    entry["avg_us"] = row.avgUs;
+                    entry["min_us"] = row.minUs;
+                    entry["max_us"] = row.maxUs;
+                    entry["p50_us"] = row.p50Us;
+                    entry["p90_us"] = row.p90Us;
+                    entry["p99_us"] = row.p99Us;
+                    entry["algbw_gbps"] = row.algBandwidthGBps;
+                    entry["busbw_gbps"] = row.busBandwidthGBps;
+                    stats.append(entry);
+                }
+                return stats;
+            })
+        .def("reset_collective_stats", &::c10d_npu::ProcessGroupHCCL::resetCollectiveStats)
+        .def("_fit_allreduce_latency",
+            [](::c10d_npu::ProcessGroupHCCL &pg) -> py::object {
+                double alphaUs = 0;
+                double betaUsPerByte = 0;
+                if (!pg.fitCollectiveLatency(c10d::OpType::ALLREDUCE, alphaUs, betaUsPerByte)) {
+                    return py::none();
+                }
+                return py::make_tuple(alphaUs, betaUsPerByte);
+            })
         .def("_get_stream_id", &::c10d_npu::ProcessGroupHCCL::getStreamId,
              py::arg("p2p") = false,
              py::arg("peer") = -1)
@@ -427,6 +581,15 @@ PyObject* c10d_npu_init(PyObject* _unused, PyObject* noargs) {
              py::arg("input"),
              py::arg("output_split_sizes") = std::vector<int64_t>{},
              py::arg("opts") = ::c10d::AllgatherOptions(),
+             py::call_guard<py::gil_scoped_release>())
+        .def("all_to_all_single_device_splits",
+            &::c10d_npu::ProcessGroupHCCL::alltoall_base_device_splits,
+             py::arg("output"),
+             py::arg("input"),
+             py::arg("output_split_sizes"),
+             py::arg("input_split_sizes"),
+             py::arg("exchange_split_sizes") = true,
+             py::arg("opts") = ::c10d::AllToAllOptions(),
              py::call_guard<py::gil_scoped_release>());
 
     intrusive_ptr_class_<::c10d_npu::ProcessGroupHCCL::Options>(
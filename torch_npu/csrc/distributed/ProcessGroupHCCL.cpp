@@ -1,14 +1,19 @@
 #include <ATen/record_function.h>
 #include <algorithm>
+#include <limits>
 #include <map>
 #include <tuple>
 #include <unordered_set>
+#include <utility>
 #include <unistd.h>
 #include <linux/limits.h>
 #include <fstream>
 #include <iostream>
 #include <functional>
+#include <iterator>
 #include <cstdlib>
+#include <numeric>
+#include <condition_variable>
 
 #include <c10/util/Optional.h>
 #include <c10/util/irange.h>
@@ -68,6 +73,34 @@ std::map<c10d::ReduceOp, std::string> unsupportedOp = {
     {c10d::ReduceOp::BXOR, "BXOR"}
 };
 
+// OpHook sampling decision of the collective being issued on this thread,
+// taken over by the work initWork creates for it.
+thread_local bool g_opHookSampled = false;
+
+// Runs the OpHook PreHook of a collective for its scope. The PostHook runs
+// when the work is waited on, in any order and possibly on another thread,
+// so the decision travels with the work instead of the OpHook stack.
+class OpHookCollectiveScope {
+public:
+    template <typename... Ts>
+    OpHookCollectiveScope(const char* opName, Ts&... args) : previous_(g_opHookSampled)
+    {
+        g_opHookSampled = C10_UNLIKELY(at_npu::native::env::CheckOpHookEnable()) &&
+            at_npu::native::OpHook::GetInstance().CollectivePreHook(opName, args...);
+    }
+
+    ~OpHookCollectiveScope()
+    {
+        g_opHookSampled = previous_;
+    }
+
+    OpHookCollectiveScope(const OpHookCollectiveScope&) = delete;
+    OpHookCollectiveScope& operator=(const OpHookCollectiveScope&) = delete;
+
+private:
+    bool previous_;
+};
+
 bool nslb_is_end = false;
 bool uce_error_flag = false;
 bool force_stop_error_flag = false;
@@ -75,6 +108,207 @@ char* nslb_path = c10_npu::option::OptionsManager::GetNslbPath();
 bool status_save_enable = c10_npu::option::OptionsManager::CheckStatusSaveEnable();
 std::string status_save_path = c10_npu::option::OptionsManager::GetStatusSavePath();
 
+// Collects NSLB data-volume records in a fixed-capacity ring and appends them
+// to the per-communicator log files from a background thread, so collectives
+// only pay for storing a few numbers instead of several filesystem syscalls
+// per launch. Records that arrive while the ring is full are dropped and
+// counted. The environment, output directory and file names are resolved once,
+// and files stay open between flushes.
+class NslbDataVolWriter {
+public:
+    static NslbDataVolWriter& GetInstance()
+    {
+        static NslbDataVolWriter instance;
+        return instance;
+    }
+
+    void Record(const std::string& commName, int rank, c10d::OpType opType, uint64_t dataVol)
+    {
+        bool wakeup = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            StartLocked();
+            if (count_ == kRingCapacity) {
+                dropped_++;
+                return;
+            }
+            ring_[(head_ + count_) % kRingCapacity] = DataVolRecord{FileIdLocked(commName, rank), opType, dataVol, rank};
+            count_++;
+            wakeup = count_ == kFlushThreshold;
+        }
+        if (wakeup) {
+            cv_.notify_one();
+        }
+    }
+
+    // Write out every buffered record before returning.
+    void Flush()
+    {
+        std::lock_guard<std::mutex> flushLock(flushMutex_);
+        uint64_t dropped = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            flushRecords_.clear();
+            for (size_t i = 0; i < count_; ++i) {
+                flushRecords_.push_back(ring_[(head_ + i) % kRingCapacity]);
+            }
+            head_ = (head_ + count_) % kRingCapacity;
+            count_ = 0;
+            for (size_t id = files_.size(); id < fileNames_.size(); ++id) {
+                files_.push_back(OpenFile(fileNames_[id]));
+            }
+            std::swap(dropped, dropped_);
+        }
+        if (dropped != 0) {
+            ASCEND_LOGW("NSLB data volume buffer was full, %llu records were dropped.",
+                        static_cast<unsigned long long>(dropped));
+        }
+        WriteRecords(flushRecords_);
+        for (auto& file : files_) {
+            if (file != nullptr) {
+                file->flush();
+            }
+        }
+    }
+
+private:
+    struct DataVolRecord {
+        uint32_t fileId;
+        c10d::OpType opType;
+        uint64_t dataVol;
+        int rank;
+    };
+
+    static constexpr size_t kRingCapacity = 8192;
+    static constexpr size_t kFlushThreshold = 1024;
+    static constexpr auto kFlushInterval = std::chrono::milliseconds(500);
+
+    NslbDataVolWriter() : ring_(kRingCapacity)
+    {
+        flushRecords_.reserve(kRingCapacity);
+    }
+
+    ~NslbDataVolWriter()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            terminate_ = true;
+        }
+        cv_.notify_one();
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+        try {
+            Flush();
+        } catch (...) {
+        }
+    }
+
+    void StartLocked()
+    {
+        if (started_) {
+            return;
+        }
+        auto master_addr = getenv("MASTER_ADDR");
+        TORCH_CHECK(master_addr != nullptr, "Unable to fetch master IP addr, environment variable is null.", DIST_ERROR(ErrCode::NOT_FOUND));
+        if (access(nslb_path, W_OK) != 0 && mkdir(nslb_path, S_IRWXU | S_IRGRP | S_IXGRP) != 0) {
+            throw std::runtime_error("Open shared directory failed. Please check whether input path is valid." + DIST_ERROR(ErrCode::NOT_FOUND));
+        }
+        masterAddr_ = master_addr;
+        auto hccl_algo = getenv("HCCL_ALGO");
+        if (hccl_algo != nullptr) {
+            hcclAlgo_ = hccl_algo;
+        }
+        thread_ = std::thread(&NslbDataVolWriter::Run, this);
+        started_ = true;
+    }
+
+    // The log file name is built once per communicator and rank.
+    uint32_t FileIdLocked(const std::string& commName, int rank)
+    {
+        auto& ids = fileIds_[commName];
+        for (const auto& id : ids) {
+            if (id.first == rank) {
+                return id.second;
+            }
+        }
+        uint32_t fileId = static_cast<uint32_t>(fileNames_.size());
+        fileNames_.push_back(c10::str(nslb_path, "/", masterAddr_, "_", commName, "_", rank, ".log"));
+        ids.emplace_back(rank, fileId);
+        return fileId;
+    }
+
+    void Run()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!terminate_) {
+            cv_.wait_for(lock, kFlushInterval, [this] { return terminate_ || count_ >= kFlushThreshold; });
+            if (count_ == 0 && dropped_ == 0) {
+                continue;
+            }
+            lock.unlock();
+            try {
+                Flush();
+            } catch (std::exception& e) {
+                ASCEND_LOGE("NSLB data volume flush failed: %s", e.what());
+            }
+            lock.lock();
+        }
+    }
+
+    // Only called with flushMutex_ held. Returns nullptr when the file cannot
+    // be created, its records are then skipped.
+    std::unique_ptr<std::ofstream> OpenFile(const std::string& out_file_path)
+    {
+        bool need_algo = !hcclAlgo_.empty() && access(out_file_path.c_str(), W_OK) != 0;
+        if (access(out_file_path.c_str(), W_OK) != 0) {
+            int fd = open(out_file_path.c_str(), O_WRONLY | O_CREAT, S_IRUSR | S_IWUSR | S_IRGRP);
+            if (fd == -1) {
+                ASCEND_LOGE("NSLB data volume file %s could not be created.", out_file_path.c_str());
+                return nullptr;
+            }
+            close(fd);
+        }
+        auto file = std::make_unique<std::ofstream>(out_file_path, std::ios::app);
+        if (need_algo) {
+            *file << "HCCL_ALGO=" << hcclAlgo_ << "\n";
+        }
+        return file;
+    }
+
+    // Only called with flushMutex_ held.
+    void WriteRecords(const std::vector<DataVolRecord>& records)
+    {
+        for (const auto& record : records) {
+            auto& file = files_[record.fileId];
+            if (file == nullptr) {
+                continue;
+            }
+            std::string opName = opTypeToString(record.opType);
+            std::transform(opName.begin(), opName.end(), opName.begin(), ::tolower);
+            *file << opName << " " << record.dataVol << " " << record.rank << "\n";
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<DataVolRecord> ring_;
+    size_t head_ = 0;
+    size_t count_ = 0;
+    uint64_t dropped_ = 0;
+    std::unordered_map<std::string, std::vector<std::pair<int, uint32_t>>> fileIds_;
+    std::vector<std::string> fileNames_;
+    bool started_ = false;
+    bool terminate_ = false;
+    std::thread thread_;
+    std::string masterAddr_;
+    std::string hcclAlgo_;
+
+    std::mutex flushMutex_;
+    std::vector<DataVolRecord> flushRecords_;
+    std::vector<std::unique_ptr<std::ofstream>> files_;
+};
+
 inline c10_npu::NPUStream getNPUStreamByCurrentType(c10::DeviceIndex device = -1)
 {
     auto current_Stream = c10_npu::getCurrentNPUStream(device);
@@ -349,6 +583,19 @@ void check_split_sizes(const std::vector<int64_t>& split_sizes, const at::Tensor
     }
 }
 
+void check_device_split_sizes(const at::Tensor& split_sizes, const at::Tensor& tensor, int group_size)
+{
+    TORCH_CHECK(split_sizes.device() == tensor.device(),
+                "Split sizes must be on the same device as the tensor, got ", split_sizes.device(),
+                " and ", tensor.device(), DIST_ERROR(ErrCode::PARAM));
+    TORCH_CHECK(split_sizes.scalar_type() == at::kLong, "Split sizes must be int64, got ",
+                split_sizes.scalar_type(), DIST_ERROR(ErrCode::TYPE));
+    TORCH_CHECK(split_sizes.dim() == 1 && split_sizes.numel() == group_size,
+                "Number of tensor splits not equal to group size", DIST_ERROR(ErrCode::PARAM));
+    TORCH_CHECK(tensor.dim() > 0, "Tensors split by device split sizes must have at least one dimension",
+                DIST_ERROR(ErrCode::PARAM));
+}
+
 void checkAndMakePath(const char* path, std::string errormessage)
 {
     try {
@@ -370,6 +617,159 @@ void createFile(const char* path)
 }
 } // namespace
 
+// Wakes the watchdog of one process group. Detach stops the notifications
+// before the process group goes away, the poller may still hold a reference.
+class WorkCompletionListener {
+public:
+    explicit WorkCompletionListener(std::function<void()> notify) : notify_(std::move(notify)) {}
+
+    void Notify()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (notify_) {
+            notify_();
+        }
+    }
+
+    void Detach()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        notify_ = nullptr;
+    }
+
+private:
+    std::mutex mutex_;
+    std::function<void()> notify_;
+};
+
+namespace {
+// Queries the end events of the outstanding work of every process group from
+// one thread per process and wakes the owning watchdog as soon as a work
+// finishes, so finished work and the comms, events and memory it holds are
+// retired within about kPollMicros. The watchdogs themselves only wake up on
+// their own for timeouts. The thread sleeps while no work is outstanding and
+// holds no reference that keeps the events of retired work alive.
+class WorkCompletionPoller {
+public:
+    static constexpr int64_t kPollMicros = 200;
+
+    static WorkCompletionPoller& GetInstance()
+    {
+        static WorkCompletionPoller instance;
+        return instance;
+    }
+
+    void Watch(const std::shared_ptr<std::vector<c10_npu::NPUEvent>>& events, const std::vector<at::Device>& devices,
+               const std::shared_ptr<WorkCompletionListener>& listener)
+    {
+        Pending pending{events, {}, listener};
+        for (const auto& device : devices) {
+            pending.devices.push_back(device.index());
+        }
+        bool wakeup = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!thread_.joinable()) {
+                thread_ = std::thread(&WorkCompletionPoller::Run, this);
+            }
+            wakeup = pending_.empty();
+            pending_.push_back(std::move(pending));
+        }
+        if (wakeup) {
+            cv_.notify_one();
+        }
+    }
+
+private:
+    struct Pending {
+        std::weak_ptr<std::vector<c10_npu::NPUEvent>> events;
+        std::vector<c10::DeviceIndex> devices;
+        std::shared_ptr<WorkCompletionListener> listener;
+    };
+
+    WorkCompletionPoller() = default;
+
+    ~WorkCompletionPoller()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_one();
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    // Errors are left to the watchdog, which queries the work again.
+    bool Finished(const Pending& pending, c10::DeviceIndex& currentDevice)
+    {
+        auto events = pending.events.lock();
+        if (events == nullptr) {
+            return true;
+        }
+        try {
+            for (const auto i : c10::irange(events->size())) {
+                if (pending.devices[i] != currentDevice) {
+                    NPU_CHECK_ERROR(c10_npu::SetDevice(pending.devices[i]));
+                    currentDevice = pending.devices[i];
+                }
+                if (!(*events)[i].query()) {
+                    return false;
+                }
+            }
+        } catch (const std::exception& e) {
+            ASCEND_LOGW("Work completion query failed: %s", e.what());
+        }
+        return true;
+    }
+
+    void Run()
+    {
+        c10::DeviceIndex currentDevice = -1;
+        std::vector<Pending> polling;
+        std::vector<Pending> waiting;
+        std::vector<std::shared_ptr<WorkCompletionListener>> finished;
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!stop_) {
+            if (pending_.empty()) {
+                cv_.wait(lock, [this] { return stop_ || !pending_.empty(); });
+            } else {
+                cv_.wait_for(lock, std::chrono::microseconds(kPollMicros), [this] { return stop_; });
+            }
+            if (stop_ || pending_.empty() || !c10_npu::NpuSysCtrl::GetInstance().GetInitFlag()) {
+                continue;
+            }
+            polling.swap(pending_);
+            lock.unlock();
+            for (auto& pending : polling) {
+                if (!Finished(pending, currentDevice)) {
+                    waiting.push_back(std::move(pending));
+                } else if (std::find(finished.begin(), finished.end(), pending.listener) == finished.end()) {
+                    finished.push_back(std::move(pending.listener));
+                }
+            }
+            polling.clear();
+            for (auto& listener : finished) {
+                listener->Notify();
+            }
+            finished.clear();
+            lock.lock();
+            // Work submitted meanwhile goes after the work still running.
+            std::move(pending_.begin(), pending_.end(), std::back_inserter(waiting));
+            pending_.swap(waiting);
+            waiting.clear();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stop_ = false;
+    std::thread thread_;
+    std::vector<Pending> pending_;
+};
+} // namespace
+
 constexpr int64_t kSynchronizeBusyWaitMillis = 10;
 constexpr int64_t maxOpNumPerSyncPoint = 2;
 const int64_t ProcessGroupHCCL::kProcessGroupHCCLOpTimeoutMillis = 10 * 1000;
@@ -402,7 +802,8 @@ ProcessGroupHCCL::WorkHCCL::WorkHCCL(
     int rank,
     c10d::OpType opType,
     uint64_t seq,
-    bool desyncDebug)
+    bool desyncDebug,
+    bool collectStats)
     : Work(rank, opType),
     devices_(devices),
     workStartTime_(std::chrono::steady_clock::now()),
@@ -420,6 +821,16 @@ ProcessGroupHCCL::WorkHCCL::WorkHCCL(
     }
 
     hcclEndEvents_ = std::make_shared<std::vector<c10_npu::NPUEvent>>(devices.size());
+    if (collectStats) {
+        statsStartEvents_ = std::make_shared<std::vector<c10_npu::NPUEvent>>();
+        statsEndEvents_ = std::make_shared<std::vector<c10_npu::NPUEvent>>();
+        statsStartEvents_->reserve(devices.size());
+        statsEndEvents_->reserve(devices.size());
+        for (size_t i = 0; i < devices.size(); i++) {
+            statsStartEvents_->emplace_back(ACL_EVENT_TIME_LINE);
+            statsEndEvents_->emplace_back(ACL_EVENT_TIME_LINE);
+        }
+    }
     hcclComms_.resize(devices.size());
 }
 
@@ -430,6 +841,10 @@ ProcessGroupHCCL::WorkHCCL::WorkHCCL(const WorkHCCL& w)
     hcclStartEvents_(w.hcclStartEvents_),
     hcclComms_(w.hcclComms_),
     hcclEndEvents_(w.hcclEndEvents_),
+    statsStartEvents_(w.statsStartEvents_),
+    statsEndEvents_(w.statsEndEvents_),
+    statsBytes_(w.statsBytes_),
+    statsDtype_(w.statsDtype_),
     blockingWait_(w.blockingWait_),
     opTimeout_(w.opTimeout_),
     workStartTime_(w.workStartTime_),
@@ -717,9 +1132,7 @@ void ProcessGroupHCCL::WorkHCCL::synchronizeInternal(std::chrono::milliseconds t
         }
     }
 
-    if (C10_UNLIKELY(at_npu::native::env::CheckOpHookEnable())) {
-        at_npu::native::OpHook::GetInstance().PostHook();
-    }
+    at_npu::native::OpHook::GetInstance().CollectivePostHook(std::exchange(opHookSampled_, false));
 }
 
 void ProcessGroupHCCL::WorkHCCL::lazyDestroy(std::vector<at::Tensor> tensors)
@@ -826,6 +1239,17 @@ ProcessGroupHCCL::ProcessGroupHCCL(
     asyncErrorHandling_ =
         static_cast<ErrorHandlingMode>(c10_npu::option::OptionsManager::CheckUseHcclAsyncErrorHandleEnable());
     desyncDebug_ = static_cast<bool>(c10_npu::option::OptionsManager::CheckUseDesyncDebugEnable());
+    collectiveStatsEnabled_ = c10_npu::option::OptionsManager::CheckCollectiveStatsEnable();
+    silenceCheckConfig_.flag = c10_npu::option::OptionsManager::GetSilenceCheckFlag();
+    if (silenceCheckConfig_.flag != c10_npu::option::CHECK_CLOSE) {
+        silenceCheckConfig_.upperThresh = c10_npu::option::OptionsManager::GetSilenceUpperThresh();
+        silenceCheckConfig_.sigmaThresh = c10_npu::option::OptionsManager::GetSilenceSigmaThresh();
+        silenceCheckConfig_.interval = c10_npu::option::OptionsManager::GetSilenceCheckInterval();
+        silenceCheckConfig_.sampleRatio = c10_npu::option::OptionsManager::GetSilenceCheckSampleRatio();
+        silenceCheckConfig_.useV3 = c10_npu::opapi::IsExistAclnnSilentCheckV2();
+        // Seeded per rank so that ranks sample different buckets of the same step.
+        silenceCheckRng_.seed(static_cast<std::mt19937::result_type>(rank));
+    }
 
     if (blockingWait_) {
         if (asyncErrorHandling_ != NoHandling || desyncDebug_) {
@@ -867,6 +1291,13 @@ ProcessGroupHCCL::ProcessGroupHCCL(
             }
         }
     }
+    completionListener_ = std::make_shared<WorkCompletionListener>([this]() {
+        {
+            std::lock_guard<std::mutex> lock(workMetaListMutex_);
+            workCompleted_ = true;
+        }
+        workMetaListCV_.notify_one();
+    });
     hcclCommWatchdogThread_ = std::thread(&ProcessGroupHCCL::hcclCommWatchdog, this);
 #endif
 
@@ -948,6 +1379,9 @@ void abortCommsFromMap(
 // Abort all communicators on this rank
 void ProcessGroupHCCL::abort(c10::optional<std::string> abortReason)
 {
+    if (nslb_path != nullptr) {
+        NslbDataVolWriter::GetInstance().Flush();
+    }
     std::lock_guard<std::mutex> lock(mutex_);
     abortCommsFromMap(devHCCLCommMap_, rank_, abortReason);
 }
@@ -985,12 +1419,18 @@ ProcessGroupHCCL::~ProcessGroupHCCL()
         global_ = nullptr;
     }
 
+    if (completionListener_ != nullptr) {
+        completionListener_->Detach();
+    }
     terminateProcessGroup_.store(true);
 
     workMetaListCV_.notify_one();
 #ifdef ENABLE_HCCL_ERROR_CHECKING
     hcclCommWatchdogThread_.join();
 #endif
+    if (nslb_path != nullptr) {
+        NslbDataVolWriter::GetInstance().Flush();
+    }
     {
         // Destropy all HCCL Communicators on Process Group Destruction
         std::lock_guard<std::mutex> lock(mutex_);
@@ -1091,7 +1531,7 @@ void ProcessGroupHCCL::workCleanupLoop()
     auto lastrecordtime = std::chrono::steady_clock::now();
     auto timenow = std::chrono::steady_clock::now();
     bool recordflag = false;
-    
+
     while (!terminateProcessGroup_.load()) {
         if (status_save_enable) {
             checkAndMakePath(status_save_path.c_str(), "Open shared directory failed. Please check whether input path is valid.");
@@ -1101,10 +1541,12 @@ void ProcessGroupHCCL::workCleanupLoop()
 
         {
         std::unique_lock<std::mutex> lock(workMetaListMutex_);
-        // We busy-poll the work vector every kWatchdogThreadSleepMillis
-        // milliseconds as long as the atomic is True.
+        // Finished work is retired as soon as WorkCompletionPoller reports
+        // it. Otherwise wake up every kWatchdogThreadSleepMillis to check
+        // timeouts, errors and save the status.
         workMetaListCV_.wait_for(lock, std::chrono::milliseconds(kWatchdogThreadSleepMillis),
-                                 [&]() -> bool { return terminateProcessGroup_.load(); });
+                                 [&]() -> bool { return terminateProcessGroup_.load() || workCompleted_; });
+        workCompleted_ = false;
         if (watchdogStatus == WatchdogStatus::STOP) {
             continue;
         }
@@ -1131,10 +1573,13 @@ void ProcessGroupHCCL::workCleanupLoop()
             }
             work.checkAndSetException();
             work.checkDispatch();
-            bool timedOut = work.checkTimeout();
+            // Work enqueued only for collective stats is not timed out or torn
+            // down here, that stays tied to the async error handling mode.
+            const bool handleErrors = asyncErrorHandling_ != NoHandling;
+            bool timedOut = handleErrors && work.checkTimeout();
 
             // If work hits an exception (either an error or timeout)
-            if (work.exception()) {
+            if (handleErrors && work.exception()) {
                 // Report desync state in case of timeout
                 if (desyncDebug_ && timedOut) {
                     try {
@@ -1171,6 +1616,9 @@ void ProcessGroupHCCL::workCleanupLoop()
                 if (status_save_enable) {
                     refreshStatusInfo(work, "end"); // Update Statusinfo，but not write into the map
                 }
+                if (!work.exception()) {
+                    updateCollectiveStats(work);
+                }
                 it = workMetaList_.erase(it);
             } else {
                 if (status_save_enable && work.isStarted()) {
@@ -1293,39 +1741,11 @@ void ProcessGroupHCCL::broadcastMasterID(
 }
 
 // record data volume for HCCL op.
-void ProcessGroupHCCL::recordDataVol(std::string opName, const std::string dataVol, const int currRank,
+void ProcessGroupHCCL::recordDataVol(c10d::OpType opType, uint64_t dataVol, const int currRank,
     std::vector<std::shared_ptr<HCCLComm>>& hcclComms)
 {
-    std::ofstream outfile;
-    std::stringstream fileName;
     std::string commName = getHcclCommNameWithoutInit(currRank, hcclComms);
-    auto master_addr = getenv("MASTER_ADDR");
-    auto hccl_algo = getenv("HCCL_ALGO");
-    TORCH_CHECK(master_addr != nullptr, "Unable to fetch master IP addr, environment variable is null.", DIST_ERROR(ErrCode::NOT_FOUND));
-    fileName << master_addr << "_" << commName << "_" << std::to_string(currRank) << ".log";
-    std::string out_file_path = c10::str(nslb_path, "/", fileName.str());
-    bool need_algo = hccl_algo != nullptr && access(out_file_path.c_str(), W_OK) != 0;
-    try {
-        if (access(nslb_path, W_OK) != 0 && mkdir(nslb_path, S_IRWXU | S_IRGRP | S_IXGRP) != 0) {
-            throw std::exception();
-        }
-        if (access(out_file_path.c_str(), W_OK) != 0) {
-            int fd = open(out_file_path.c_str(), O_WRONLY | O_CREAT, S_IRUSR | S_IWUSR | S_IRGRP);
-            if (fd == -1) {
-                throw std::exception();
-            }
-            close(fd);
-        }
-        outfile.open(out_file_path, std::ios::app);
-    } catch (std::exception& e) {
-        throw std::runtime_error("Open shared directory failed. Please check whether input path is valid." + DIST_ERROR(ErrCode::NOT_FOUND));
-    }
-    std::transform(opName.begin(), opName.end(), opName.begin(), ::tolower);
-    if (need_algo) {
-        outfile << "HCCL_ALGO=" << hccl_algo << "\n";
-    }
-    outfile << opName << " " << dataVol << " " << std::to_string(currRank) << "\n";
-    outfile.close();
+    NslbDataVolWriter::GetInstance().Record(commName, currRank, opType, dataVol);
 }
 
 void ProcessGroupHCCL::refreshStatusInfo(ProcessGroupHCCL::WorkHCCL work, std::string status)
@@ -1456,12 +1876,13 @@ std::vector<std::shared_ptr<HCCLComm>>& ProcessGroupHCCL::getHCCLComm(
             "the NPU devices are not known" + DIST_ERROR(ErrCode::PARAM));
     }
 
-    for (auto& device : devices) {
-        usedDeviceIdxs_.insert(device.index());
-    }
-
     {
+        // init_hccl_comms creates communicators from worker threads, so the
+        // device set is updated under the same lock as the communicator map.
         std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& device : devices) {
+            usedDeviceIdxs_.insert(device.index());
+        }
         if (devHCCLCommMap_.find(devicesKey) != devHCCLCommMap_.end()) {
             // Reuse the cached communicator if there is one.
             return devHCCLCommMap_[devicesKey];
@@ -1920,8 +2341,66 @@ std::vector<at::Tensor> flatten_for_scatter_gather(
     return flattened;
 }
 
+// Check whether every tensor in `tensors' is a dense, base-format, non-empty
+// slice of one shared storage. If so, `base' is set to a 1-D view spanning all
+// of them and `displs' to the element offset of each tensor inside `base', so
+// a v-style collective can read from or write to the tensors in place.
+bool get_storage_displacements(
+    const std::vector<at::Tensor>& tensors,
+    std::vector<uint64_t>& displs,
+    at::Tensor& base)
+{
+    if (tensors.empty()) {
+        return false;
+    }
+    const auto& first = tensors.front();
+    const auto* storageImpl = first.storage().unsafeGetStorageImpl();
+    std::vector<std::pair<int64_t, int64_t>> ranges;
+    ranges.reserve(tensors.size());
+    for (const auto& t : tensors) {
+        if (t.numel() == 0 || !t.is_contiguous() || t.scalar_type() != first.scalar_type() ||
+            t.storage().unsafeGetStorageImpl() != storageImpl ||
+            !at_npu::native::FormatHelper::IsBaseFormatType(t)) {
+            return false;
+        }
+        ranges.emplace_back(t.storage_offset(), t.numel());
+    }
+
+    auto sorted = ranges;
+    std::sort(sorted.begin(), sorted.end());
+    for (size_t i = 1; i < sorted.size(); ++i) {
+        if (sorted[i - 1].first + sorted[i - 1].second > sorted[i].first) {
+            return false;
+        }
+    }
+    const int64_t minOffset = sorted.front().first;
+    const int64_t extent = sorted.back().first + sorted.back().second - minOffset;
+
+    displs.clear();
+    displs.reserve(ranges.size());
+    for (const auto& range : ranges) {
+        displs.push_back(static_cast<uint64_t>(range.first - minOffset));
+    }
+    base = first.as_strided({extent}, {1}, minOffset);
+    return true;
+}
+
+// Whether `displs' lays out equally sized chunks back to back in rank order,
+// i.e. the layout a plain (non-v) allgather or reduce_scatter produces.
+bool is_rank_ordered_layout(const std::vector<uint64_t>& displs, uint64_t count)
+{
+    for (size_t i = 0; i < displs.size(); ++i) {
+        if (displs[i] != i * count) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void nslb_record_end()
 {
+    // The end marker tells consumers the data volume logs are complete.
+    NslbDataVolWriter::GetInstance().Flush();
     std::string end_file_path;
     std::ofstream endfile;
     end_file_path = c10::str(nslb_path, "/end_", getenv("MASTER_ADDR"), "_", getpid(), ".log");
@@ -1951,7 +2430,10 @@ c10::intrusive_ptr<ProcessGroupHCCL::WorkHCCL> ProcessGroupHCCL::initWork(
     if (devices.size() != 1) {
         throw std::runtime_error("ProcessGroupHCCL support one device per process only" + DIST_ERROR(ErrCode::NOT_SUPPORT));
     }
-    return c10::make_intrusive<ProcessGroupHCCL::WorkHCCL>(devices, rank, opType, op_id_, desyncDebug_);
+    auto work = c10::make_intrusive<ProcessGroupHCCL::WorkHCCL>(
+        devices, rank, opType, op_id_, desyncDebug_, collectiveStatsEnabled_.load(std::memory_order_relaxed));
+    work->opHookSampled_ = std::exchange(g_opHookSampled, false);
+    return work;
 }
 
 void ProcessGroupHCCL::workEnqueue(c10::intrusive_ptr<ProcessGroupHCCL::WorkHCCL> work)
@@ -1972,12 +2454,17 @@ void ProcessGroupHCCL::workEnqueue(c10::intrusive_ptr<ProcessGroupHCCL::WorkHCCL
         return;
     }
     if (!terminateProcessGroup_.load()) {
-        std::lock_guard<std::mutex> lock(workMetaListMutex_);
-        // Avoid view tensors to be processed in cleanup thread.
-        // View tensors' destruction invokes autograd_meta, which
-        // needs to be destructed in user thread. Otherwise will
-        // get deadlock. Here we enqueue work without outputs_.
-        workMetaList_.emplace_back(*work);
+        {
+            std::lock_guard<std::mutex> lock(workMetaListMutex_);
+            // Avoid view tensors to be processed in cleanup thread.
+            // View tensors' destruction invokes autograd_meta, which
+            // needs to be destructed in user thread. Otherwise will
+            // get deadlock. Here we enqueue work without outputs_.
+            workMetaList_.emplace_back(*work);
+        }
+        if (completionListener_ != nullptr) {
+            WorkCompletionPoller::GetInstance().Watch(work->hcclEndEvents_, work->devices_, completionListener_);
+        }
     }
 }
 
@@ -2010,6 +2497,81 @@ int64_t ProcessGroupHCCL::getHcclComm(int rankid)
     return hccl_comm;
 }
 
+double ProcessGroupHCCL::initHcclCommEagerly(c10::DeviceIndex deviceIndex)
+{
+    std::vector<at::Device> devices = {at::Device(c10::DeviceType::PrivateUse1, deviceIndex)};
+    const auto key = getKeyFromDevices(devices);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (devHCCLCommMap_.find(key) != devHCCLCommMap_.end()) {
+            return 0.0;
+        }
+    }
+    auto start = std::chrono::steady_clock::now();
+    if (!options_->hccl_config.empty()) {
+        HcclCommConfig config = createHcclCommConfigWithOptions();
+        getHCCLComm(key, devices, HcclCommType::DEFAULT, &config);
+    } else {
+        getHCCLComm(key, devices);
+    }
+    auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+    ASCEND_LOGI("Eagerly created HCCL communicator in %.3f ms, group id is %s.", elapsed.count(),
+        options_->group_id.c_str());
+    return elapsed.count();
+}
+
+std::vector<double> ProcessGroupHCCL::initHcclComms(
+    const std::vector<c10::intrusive_ptr<ProcessGroupHCCL>>& groups,
+    size_t maxWorkers)
+{
+    std::vector<double> latencies(groups.size(), 0.0);
+    // A group listed twice must not be created by two threads at once, later
+    // entries report 0 like an already created communicator.
+    std::vector<size_t> pending;
+    std::unordered_set<ProcessGroupHCCL*> seen;
+    for (size_t i = 0; i < groups.size(); ++i) {
+        TORCH_CHECK(groups[i], "Process group at index ", i, " is null", DIST_ERROR(ErrCode::PARAM));
+        if (seen.insert(groups[i].get()).second) {
+            pending.push_back(i);
+        }
+    }
+    if (pending.empty()) {
+        return latencies;
+    }
+
+    const c10::DeviceIndex deviceIndex = c10_npu::current_device();
+    const size_t numWorkers = maxWorkers == 0 ? pending.size() : std::min(maxWorkers, pending.size());
+    // Creating a communicator blocks until every member of the group joins. Since
+    // groups are taken in list order, the lowest unfinished group always has all
+    // of its members working on it, so a bounded number of workers cannot deadlock.
+    std::atomic<size_t> next{0};
+    std::vector<std::exception_ptr> errors(groups.size());
+    std::vector<std::thread> workers;
+    workers.reserve(numWorkers);
+    for (size_t w = 0; w < numWorkers; ++w) {
+        workers.emplace_back([&]() {
+            for (size_t n = next++; n < pending.size(); n = next++) {
+                const size_t i = pending[n];
+                try {
+                    NPU_CHECK_ERROR(c10_npu::SetDevice(deviceIndex));
+                    latencies[i] = groups[i]->initHcclCommEagerly(deviceIndex);
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+    return latencies;
+}
+
 void ProcessGroupHCCL::resumeHcclComm(int device_id)
 {
     at::Device device = at::Device(c10::DeviceType::PrivateUse1, device_id);
@@ -2134,8 +2696,8 @@ std::string mapToJson(const std::unordered_map<std::string, std::string>& map)
     return ss.str();
 }
 
-std::string ProcessGroupHCCL::getMstxHcclMsg(
-    const std::string &opName, uint64_t dataCnt, HcclDataType dataType, HcclComm comm, int64_t streamId)
+const char *ProcessGroupHCCL::getMstxHcclMsg(
+    const char *opName, uint64_t dataCnt, HcclDataType dataType, HcclComm comm, int64_t streamId)
 {
     const static std::map<HcclDataType, std::string> dataTypes = {
         {HCCL_DATA_TYPE_INT8, "int8"},
@@ -2152,12 +2714,23 @@ std::string ProcessGroupHCCL::getMstxHcclMsg(
         {HCCL_DATA_TYPE_BFP16, "bfp16"}
     };
     static std::map<HcclComm, std::string> commNames;
-    if (!torch_npu::profiler::mstxEnable()) {
+    // Collectives repeat with the same arguments step after step, so each
+    // message is formatted once and then looked up by its arguments.
+    using MsgKey = std::tuple<const char *, uint64_t, HcclDataType, HcclComm, int64_t>;
+    static std::map<MsgKey, const char *> messages;
+    static std::mutex messagesMutex;
+    static thread_local std::string uninterned;
+    if (!torch_npu::profiler::MstxMgr::GetInstance()->isDomainEnable(torch_npu::profiler::DOMAIN_COMMUNICATION)) {
         return "";
     }
+    MsgKey key{opName, dataCnt, dataType, comm, streamId};
+    std::lock_guard<std::mutex> lock(messagesMutex);
+    auto msgIter = messages.find(key);
+    if (msgIter != messages.end()) {
+        return msgIter->second;
+    }
     std::unordered_map<std::string, std::string> msgDict;
     msgDict["opName"] = opName;
-    std::string hccl_message_str = "comm:" + opName + "-";
     auto nameIter = commNames.find(comm);
     if (nameIter == commNames.end()) {
         char commName[MAX_GROUP_NAME_LEN];
@@ -2168,7 +2741,6 @@ std::string ProcessGroupHCCL::getMstxHcclMsg(
     } else {
         msgDict["commName"] = nameIter->second;
     }
-    hccl_message_str += "-";
     std::string data_type_str = "na";
     auto iter = dataTypes.find(dataType);
     if (iter != dataTypes.end()) {
@@ -2177,7 +2749,26 @@ std::string ProcessGroupHCCL::getMstxHcclMsg(
     msgDict["dataType"] = data_type_str;
     msgDict["dataCnt"] = std::to_string(dataCnt);
     msgDict["streamId"] = std::to_string(streamId);
-    return mapToJson(msgDict);
+    std::string message = mapToJson(msgDict);
+    const char *interned = torch_npu::profiler::MstxMgr::GetInstance()->internCommMessage(message);
+    if (interned == nullptr) {
+        uninterned = std::move(message);
+        return uninterned.c_str();
+    }
+    messages.emplace(key, interned);
+    return interned;
+}
+
+bool ProcessGroupHCCL::shouldSampleSilenceCheck()
+{
+    if (silenceCheckConfig_.interval > 1 &&
+        c10_npu::model_state().get_backward_step() % silenceCheckConfig_.interval != 0) {
+        return false;
+    }
+    if (silenceCheckConfig_.sampleRatio < 1.0) {
+        return silenceCheckDist_(silenceCheckRng_) < silenceCheckConfig_.sampleRatio;
+    }
+    return true;
 }
 
 void ProcessGroupHCCL::silenceCheck(at::Tensor &input, c10d::OpType opType)
@@ -2199,50 +2790,157 @@ void ProcessGroupHCCL::silenceCheck(at::Tensor &input, c10d::OpType opType)
             return;
         }
     }
-    if (c10_npu::opapi::IsExistAclnnSilentCheckV2()) {
-        at::Tensor val = input.detach().pow(2).max().view(-1);
-        at::Tensor max;
-        if (silenceCheckCache_.find(opType) == silenceCheckCache_.end()) {
+    if (!shouldSampleSilenceCheck()) {
+        return;
+    }
+    const auto checkMode = static_cast<int64_t>(silenceCheckConfig_.flag);
+    auto cache = silenceCheckCache_.find(opType);
+    if (silenceCheckConfig_.useV3) {
+        // max(x^2) == max(|x|)^2, so a single inf-norm reduction replaces the
+        // elementwise square and its full-size temporary.
+        at::Tensor val = at::norm(input.detach(), std::numeric_limits<double>::infinity()).pow(2).view(-1);
+        at::Tensor max = val;
+        if (cache == silenceCheckCache_.end()) {
             at::Tensor stepTensor = at::zeros({1}, input.options().dtype(at::kLong));
-            at::Tensor avg = input.detach().pow(2).max().view(-1);
-            max = avg;
-            silenceCheckCache_.emplace(opType, std::make_pair(std::move(stepTensor), std::move(avg)));
-        } else {
-            max = val;
+            cache = silenceCheckCache_.emplace(opType, std::make_pair(std::move(stepTensor), val.clone())).first;
+            max = cache->second.second;
         }
         static double beta1 = 0.99;
-        op_plugin::_npu_silent_check_v3(val, input, silenceCheckCache_[opType].first, max, silenceCheckCache_[opType].second,
-            c10_npu::option::OptionsManager::GetSilenceUpperThresh().first, c10_npu::option::OptionsManager::GetSilenceUpperThresh().second,
-            beta1, static_cast<int64_t>(c10_npu::option::OptionsManager::GetSilenceCheckFlag()));
+        op_plugin::_npu_silent_check_v3(val, input, cache->second.first, max, cache->second.second,
+            silenceCheckConfig_.upperThresh.first, silenceCheckConfig_.upperThresh.second, beta1, checkMode);
     } else {
-        if (silenceCheckCache_.find(opType) == silenceCheckCache_.end()) {
+        if (cache == silenceCheckCache_.end()) {
             at::Tensor stepTensor = at::zeros({1}, input.options().dtype(at::kLong));
             at::Tensor cacheTensor = at::zeros({3}, input.options().dtype(at::kFloat));
-            silenceCheckCache_.emplace(opType, std::make_pair(std::move(stepTensor), std::move(cacheTensor)));
+            cache = silenceCheckCache_.emplace(opType, std::make_pair(std::move(stepTensor), std::move(cacheTensor))).first;
         }
         at::Tensor val = at::norm(input);
         static double min_steps = 100.0;
-        op_plugin::_npu_silent_check_v2(val, input, silenceCheckCache_[opType].second, silenceCheckCache_[opType].first, min_steps,
-            c10_npu::option::OptionsManager::GetSilenceUpperThresh().first, c10_npu::option::OptionsManager::GetSilenceSigmaThresh().first,
-            c10_npu::option::OptionsManager::GetSilenceUpperThresh().second, c10_npu::option::OptionsManager::GetSilenceSigmaThresh().second,
-            static_cast<int64_t>(c10_npu::option::OptionsManager::GetSilenceCheckFlag()));
+        op_plugin::_npu_silent_check_v2(val, input, cache->second.second, cache->second.first, min_steps,
+            silenceCheckConfig_.upperThresh.first, silenceCheckConfig_.sigmaThresh.first,
+            silenceCheckConfig_.upperThresh.second, silenceCheckConfig_.sigmaThresh.second, checkMode);
     }
 }
 
-HcclCommConfig ProcessGroupHCCL::createHcclCommConfigWithOptions()
+void ProcessGroupHCCL::recordCollectiveStatsStart(
+    c10::intrusive_ptr<WorkHCCL>& work,
+    std::vector<c10_npu::NPUStream>& hcclStreams,
+    const std::vector<at::Tensor>& inputs,
+    const std::vector<at::Tensor>& outputs)
 {
-    HcclCommConfig config;
-    getHcclCommConfig(&config);
-
-    if (options_->hccl_config.find("hccl_buffer_size") != options_->hccl_config.end()) {
-        if (std::holds_alternative<uint32_t>(options_->hccl_config["hccl_buffer_size"])) {
-            config.hcclBufferSize = std::get<uint32_t>(options_->hccl_config["hccl_buffer_size"]);
-        } else {
-            TORCH_CHECK(false, "Value type of hccl_buffer_size should be int.", DIST_ERROR(ErrCode::TYPE));
-        }
+    if (!work->statsStartEvents_) {
+        return;
+    }
+    uint64_t inputBytes = 0;
+    uint64_t outputBytes = 0;
+    for (const auto& input : inputs) {
+        inputBytes += input.nbytes();
+    }
+    for (const auto& output : outputs) {
+        outputBytes += output.nbytes();
     }
+    // Gathers are sized by their output and scatters by their input, the way
+    // nccl-tests reports them.
+    work->statsBytes_ = std::max(inputBytes, outputBytes);
+    if (!inputs.empty()) {
+        work->statsDtype_ = inputs[0].scalar_type();
+    } else if (!outputs.empty()) {
+        work->statsDtype_ = outputs[0].scalar_type();
+    }
+    for (size_t i = 0; i < work->statsStartEvents_->size(); ++i) {
+        (*work->statsStartEvents_)[i].record(hcclStreams[i]);
+    }
+}
 
-    if (options_->hccl_config.find("group_name") != options_->hccl_config.end()) {
+void ProcessGroupHCCL::recordCollectiveStatsEnd(
+    c10::intrusive_ptr<WorkHCCL>& work,
+    std::vector<c10_npu::NPUStream>& hcclStreams)
+{
+    if (!work->statsEndEvents_) {
+        return;
+    }
+    for (size_t i = 0; i < work->statsEndEvents_->size(); ++i) {
+        (*work->statsEndEvents_)[i].record(hcclStreams[i]);
+    }
+}
+
+void ProcessGroupHCCL::updateCollectiveStats(WorkHCCL& work)
+{
+    if (!work.statsStartEvents_ || !work.statsEndEvents_ || work.statsRecorded_) {
+        return;
+    }
+    work.statsRecorded_ = true;
+    // HCCL works run on a single device, see initWork.
+    auto& start = (*work.statsStartEvents_)[0];
+    auto& end = (*work.statsEndEvents_)[0];
+    if (!start.isCreated() || !end.isCreated()) {
+        return;
+    }
+    // Both events have completed here, so unlike NPUEvent::elapsed_time there is
+    // no need to drain the task queues or synchronize.
+    float elapsedMs = 0;
+    aclError ret = aclrtEventElapsedTime(&elapsedMs, start.event(), end.event());
+    if (ret != ACL_ERROR_NONE) {
+        ASCEND_LOGW("Failed to get the elapsed time of %s for collective statistics, ret = %d.",
+            opTypeToString(work.opType_).c_str(), ret);
+        return;
+    }
+    collectiveStats_.record(work.opType_, work.statsDtype_, work.statsBytes_,
+        static_cast<double>(elapsedMs) * 1000.0);
+}
+
+void ProcessGroupHCCL::setCollectiveStatsEnabled(bool enabled)
+{
+    collectiveStatsEnabled_.store(enabled);
+}
+
+bool ProcessGroupHCCL::isCollectiveStatsEnabled() const
+{
+    return collectiveStatsEnabled_.load();
+}
+
+void ProcessGroupHCCL::updateFinishedCollectiveStats()
+{
+    std::lock_guard<std::mutex> lock(workMetaListMutex_);
+    for (auto& work : workMetaList_) {
+        if (work.statsStartEvents_ && !work.statsRecorded_ && !work.exception() &&
+            work.finishedNPUExecutionInternal()) {
+            updateCollectiveStats(work);
+        }
+    }
+}
+
+std::vector<CollectiveStatsRow> ProcessGroupHCCL::getCollectiveStats()
+{
+    updateFinishedCollectiveStats();
+    return collectiveStats_.snapshot(size_);
+}
+
+bool ProcessGroupHCCL::fitCollectiveLatency(c10d::OpType opType, double& alphaUs, double& betaUsPerByte)
+{
+    updateFinishedCollectiveStats();
+    return collectiveStats_.fitLatencyModel(opType, alphaUs, betaUsPerByte);
+}
+
+void ProcessGroupHCCL::resetCollectiveStats()
+{
+    collectiveStats_.reset();
+}
+
+HcclCommConfig ProcessGroupHCCL::createHcclCommConfigWithOptions()
+{
+    HcclCommConfig config;
+    getHcclCommConfig(&config);
+
+    if (options_->hccl_config.find("hccl_buffer_size") != options_->hccl_config.end()) {
+        if (std::holds_alternative<uint32_t>(options_->hccl_config["hccl_buffer_size"])) {
+            config.hcclBufferSize = std::get<uint32_t>(options_->hccl_config["hccl_buffer_size"]);
+        } else {
+            TORCH_CHECK(false, "Value type of hccl_buffer_size should be int.", DIST_ERROR(ErrCode::TYPE));
+        }
+    }
+
+    if (options_->hccl_config.find("group_name") != options_->hccl_config.end()) {
         if (std::holds_alternative<std::string>(options_->hccl_config["group_name"])) {
             auto groupName = std::get<std::string>(options_->hccl_config["group_name"]);
             uint32_t udiLength = groupName.length();
@@ -2303,7 +3001,7 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::collective(
     // No need to detect batch_isend_irecv inputs is incorrect, need require special treatments.
     // Broadcast only need detect src rank, need require special treatments.
     if (c10_npu::model_state().get_model_mode() == c10_npu::ModelMode::L_TRAIN
-        && c10_npu::option::OptionsManager::GetSilenceCheckFlag() != c10_npu::option::CHECK_CLOSE
+        && silenceCheckConfig_.flag != c10_npu::option::CHECK_CLOSE
         && opType != c10d::OpType::UNKNOWN && opType != c10d::OpType::BROADCAST) {
         for (const auto i : c10::irange(inputs.size())) {
             npuGuard.set_index(devices[i].index());
@@ -2313,6 +3011,7 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::collective(
     }
 
     pre(hcclStreams, work);
+    recordCollectiveStatsStart(work, hcclStreams, inputs, outputs);
 
     if (nslb_path != nullptr && !nslb_is_end) {
         auto nslb_num = c10_npu::option::OptionsManager::GetNslbCntVal();
@@ -2321,9 +3020,9 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::collective(
             for (auto tensor:inputs) {
                 dataVol += tensor.storage().nbytes();
             }
-            char* global_rank = getenv("RANK");
+            static char* global_rank = getenv("RANK");
             TORCH_CHECK(global_rank != nullptr, "Unable to fetch global rank for NSLB.", DIST_ERROR(ErrCode::NOT_FOUND));
-            recordDataVol(opTypeToString(opType), std::to_string(dataVol), atoi(global_rank), hcclComms);
+            recordDataVol(opType, dataVol, atoi(global_rank), hcclComms);
         }
         if (op_id_ >= nslb_num) {
             nslb_is_end = true;
@@ -2401,6 +3100,7 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::collective(
             }
         }
     }
+    recordCollectiveStatsEnd(work, hcclStreams);
     post(hcclStreams, work);
     {
         c10_npu::NPUMultiStreamGuard guard(hcclStreams);
@@ -2419,7 +3119,7 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::collective(
     work->blockingWait_ = blockingWait_;
     work->opTimeout_ = options_->timeout;
     work->store_ = store_;
-    if (asyncErrorHandling_ != NoHandling) {
+    if (asyncErrorHandling_ != NoHandling || work->statsStartEvents_) {
         workEnqueue(work);
     }
     
@@ -2466,7 +3166,7 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::collectiveCoalesced(
 
     // No need to detect batch_isend_irecv inputs is incorrect, need require special treatments.
     if (c10_npu::model_state().get_model_mode() == c10_npu::ModelMode::L_TRAIN
-        && c10_npu::option::OptionsManager::GetSilenceCheckFlag() != c10_npu::option::CHECK_CLOSE
+        && silenceCheckConfig_.flag != c10_npu::option::CHECK_CLOSE
         && opType != c10d::OpType::UNKNOWN) {
         for (const auto i : c10::irange(inputs.size())) {
             npuGuard.set_index(devices[0].index());
@@ -2476,6 +3176,7 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::collectiveCoalesced(
     }
 
     pre(hcclStreams, work);
+    recordCollectiveStatsStart(work, hcclStreams, inputs, outputs);
 
     if (nslb_path != nullptr && !nslb_is_end) {
         auto nslb_num = c10_npu::option::OptionsManager::GetNslbCntVal();
@@ -2484,9 +3185,9 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::collectiveCoalesced(
             for (auto tensor:inputs) {
                 dataVol += tensor.storage().nbytes();
             }
-            char* global_rank = getenv("RANK");
+            static char* global_rank = getenv("RANK");
             TORCH_CHECK(global_rank != nullptr, "Unable to fetch global rank for NSLB.", DIST_ERROR(ErrCode::NOT_FOUND));
-            recordDataVol(opTypeToString(opType), std::to_string(dataVol), atoi(global_rank), hcclComms);
+            recordDataVol(opType, dataVol, atoi(global_rank), hcclComms);
         }
         if (op_id_ >= nslb_num) {
             nslb_is_end = true;
@@ -2564,6 +3265,7 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::collectiveCoalesced(
             }
         }
     }
+    recordCollectiveStatsEnd(work, hcclStreams);
     post(hcclStreams, work);
     {
         c10_npu::NPUMultiStreamGuard guard(hcclStreams);
@@ -2581,7 +3283,7 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::collectiveCoalesced(
     work->blockingWait_ = blockingWait_;
     work->opTimeout_ = options_->timeout;
     work->store_ = store_;
-    if (asyncErrorHandling_ != NoHandling) {
+    if (asyncErrorHandling_ != NoHandling || work->statsStartEvents_) {
         workEnqueue(work);
     }
     
@@ -2641,7 +3343,7 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::pointToPoint(
 
     // No need to detect recv. batch_isend_irecv inputs is incorrect, need require special treatments.
     if (c10_npu::model_state().get_model_mode() == c10_npu::ModelMode::L_TRAIN
-        && c10_npu::option::OptionsManager::GetSilenceCheckFlag() != c10_npu::option::CHECK_CLOSE
+        && silenceCheckConfig_.flag != c10_npu::option::CHECK_CLOSE
         && opType == c10d::OpType::SEND) {
         for (const auto i : c10::irange(tensors.size())) {
             npuGuard.set_index(devices[i].index());
@@ -2651,6 +3353,7 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::pointToPoint(
     }
 
     pre(hcclStreams_[key], work);
+    recordCollectiveStatsStart(work, hcclStreams_[key], tensors, tensors);
 
     if (nslb_path != nullptr && !nslb_is_end) {
         auto nslb_num = c10_npu::option::OptionsManager::GetNslbCntVal();
@@ -2659,10 +3362,10 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::pointToPoint(
             for (auto tensor : tensors) {
                 dataVol += tensor.storage().nbytes();
             }
-            char* global_rank = getenv("RANK");
+            static char* global_rank = getenv("RANK");
             TORCH_CHECK(global_rank != nullptr, "Unable to fetch global rank for NSLB.",
                         DIST_ERROR(ErrCode::NOT_FOUND));
-            recordDataVol(opTypeToString(opType), std::to_string(dataVol), atoi(global_rank), hcclComms);
+            recordDataVol(opType, dataVol, atoi(global_rank), hcclComms);
         }
         if (op_id_ >= nslb_num) {
             nslb_is_end = true;
@@ -2731,6 +3434,7 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::pointToPoint(
             HCCL_CHECK_ERROR(fn(tensors[i], hcclComms[i]->getHcclComm(), hcclStream, work->is_dispatched, p2pTargetRank), opTypeToString(opType).c_str());
         }
     }
+    recordCollectiveStatsEnd(work, hcclStreams_[key]);
     post(hcclStreams_[key], work);
 
     // End event should only be recorded after the hcclGroupEnd()
@@ -2753,7 +3457,7 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::pointToPoint(
         work->future_->markCompleted(at::IValue(*work->outputs_));
     }
 
-    if (asyncErrorHandling_ != NoHandling) {
+    if (asyncErrorHandling_ != NoHandling || work->statsStartEvents_) {
         workEnqueue(work);
     }
 
@@ -2799,9 +3503,7 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::allreduce(
 {
     check_npu_tensors_different_devices(tensors);
 
-    if (C10_UNLIKELY(at_npu::native::env::CheckOpHookEnable())) {
-        at_npu::native::OpHook::GetInstance().PreHook("allreduce", tensors);
-    }
+    OpHookCollectiveScope opHookScope("allreduce", tensors);
 
     std::vector<at::Tensor> tensors_cp = {tensors[0]};
     std::string functionName = __FUNCTION__;
@@ -2858,9 +3560,7 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::batch_isend_irecv(
     std::vector<at::Tensor>& tensors,
     std::vector<uint32_t> remote_rank_list)
 {
-    if (C10_UNLIKELY(at_npu::native::env::CheckOpHookEnable())) {
-        at_npu::native::OpHook::GetInstance().PreHook("batch_isend_irecv", tensors);
-    }
+    OpHookCollectiveScope opHookScope("batch_isend_irecv", tensors);
 
     std::vector<at::Tensor> tensors_tmp = {tensors[0]};
     auto streamId = getStreamId(false, -1);
@@ -2909,7 +3609,7 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::batch_isend_irecv(
         [&](std::vector<c10_npu::NPUStream>& hcclStreams, c10::intrusive_ptr<ProcessGroupHCCL::WorkHCCL>&) {
             // No need to detect recv.
             if (c10_npu::model_state().get_model_mode() == c10_npu::ModelMode::L_TRAIN
-                && c10_npu::option::OptionsManager::GetSilenceCheckFlag() != c10_npu::option::CHECK_CLOSE) {
+                && silenceCheckConfig_.flag != c10_npu::option::CHECK_CLOSE) {
                 for (size_t i = 0; i < op_type.size(); ++i) {
                     if (op_type[i] != "irecv") {
                         c10_npu::NPUStreamGuard guard(hcclStreams[0]);
@@ -2929,9 +3629,7 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::broadcast(
 {
     check_npu_tensors_different_devices(tensors);
 
-    if (C10_UNLIKELY(at_npu::native::env::CheckOpHookEnable())) {
-        at_npu::native::OpHook::GetInstance().PreHook("broadcast", tensors);
-    }
+    OpHookCollectiveScope opHookScope("broadcast", tensors);
     auto streamId = getStreamId(false, -1);
     return collective(
         tensors,
@@ -2958,7 +3656,7 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::broadcast(
         [&](std::vector<c10_npu::NPUStream>& hcclStreams, c10::intrusive_ptr<ProcessGroupHCCL::WorkHCCL>&) {
             // Only need detect src rank.
             if (c10_npu::model_state().get_model_mode() == c10_npu::ModelMode::L_TRAIN
-                && c10_npu::option::OptionsManager::GetSilenceCheckFlag() != c10_npu::option::CHECK_CLOSE) {
+                && silenceCheckConfig_.flag != c10_npu::option::CHECK_CLOSE) {
                 const std::vector<uint32_t>& ranks = groupRanks();
                 if (opts.rootRank == ranks[rank_]) {
                     for (const auto i : c10::irange(tensors.size())) {
@@ -2972,11 +3670,147 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::broadcast(
         c10d::OpType::BROADCAST);
 }
 
+c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::allreduceCoalescedBucketed(
+    std::vector<at::Tensor>& tensors,
+    const c10d::AllreduceCoalescedOptions& opts,
+    uint64_t bucketCap)
+{
+    // Group tensors by dtype, keeping the caller's order inside each group,
+    // and close a bucket once adding the next tensor would exceed bucketCap.
+    std::vector<std::vector<size_t>> buckets;
+    std::vector<uint64_t> bucketBytes;
+    std::map<at::ScalarType, size_t> openBucket;
+    for (const auto i : c10::irange(tensors.size())) {
+        uint64_t nbytes = static_cast<uint64_t>(tensors[i].numel()) * tensors[i].element_size();
+        auto it = openBucket.find(tensors[i].scalar_type());
+        if (it == openBucket.end() || bucketBytes[it->second] + nbytes > bucketCap) {
+            openBucket[tensors[i].scalar_type()] = buckets.size();
+            buckets.emplace_back();
+            bucketBytes.push_back(0);
+            it = openBucket.find(tensors[i].scalar_type());
+        }
+        buckets[it->second].push_back(i);
+        bucketBytes[it->second] += nbytes;
+    }
+
+    // Layouts that keep changing would otherwise grow the cache without bound.
+    static constexpr size_t kMaxCoalescedBucketCacheSize = 64;
+    if (coalescedBucketCache_.size() + buckets.size() > kMaxCoalescedBucketCacheSize) {
+        coalescedBucketCache_.clear();
+    }
+
+    // Pack on the current stream, syncStreams then orders the collective after it.
+    auto currentStream = c10_npu::getCurrentNPUStream();
+    std::vector<at::Tensor> flats;
+    std::vector<std::vector<int64_t>> bucketNumels;
+    std::vector<std::shared_ptr<c10_npu::NPUEvent>> releaseEvents;
+    for (const auto b : c10::irange(buckets.size())) {
+        const auto& bucket = buckets[b];
+        std::vector<int64_t> numels;
+        std::vector<at::Tensor> pieces;
+        // The bucket index keeps two buckets of the same shape within one call
+        // from sharing a buffer.
+        std::string layout = std::to_string(b) + "_" + c10::toString(tensors[bucket[0]].scalar_type());
+        for (auto idx : bucket) {
+            numels.push_back(tensors[idx].numel());
+            pieces.push_back(tensors[idx].reshape({-1}));
+            layout += "_" + std::to_string(tensors[idx].numel());
+        }
+        auto& entry = coalescedBucketCache_[layout];
+        if (!entry.flat.defined()) {
+            int64_t total = std::accumulate(numels.begin(), numels.end(), int64_t{0});
+            entry.flat = at::empty({total}, tensors[bucket[0]].options());
+            entry.releaseEvent = std::make_shared<c10_npu::NPUEvent>();
+        } else {
+            entry.releaseEvent->block(currentStream);
+        }
+        at::cat_out(entry.flat, pieces, 0);
+        flats.push_back(entry.flat);
+        bucketNumels.push_back(std::move(numels));
+        releaseEvents.push_back(entry.releaseEvent);
+    }
+
+    std::string functionName = "allreduce_coalesced";
+    auto streamId = getStreamId(false, -1);
+    return collectiveCoalesced(
+        flats,
+        flats,
+        [&](at::Tensor& input, at::Tensor& output, HcclComm comm, c10_npu::NPUStream& stream, std::shared_ptr<bool> is_dispatched) {
+            auto hcclType = getHcclDataType(input.scalar_type());
+            checkSupportedDataType(hcclType, functionName);
+            RECORD_FUNCTION("HcclAllreduce", std::vector<c10::IValue>({input}));
+
+            auto inputDataPtr = input.data_ptr();
+            auto outputDataPtr = output.data_ptr();
+            auto numel = getNumelForHCCL(input);
+            auto hcclReduceOp = getHcclReduceOp(opts.reduceOp, input);
+            auto hccl_call = [inputDataPtr, outputDataPtr, numel, hcclType, hcclReduceOp, comm, stream, is_dispatched, streamId]() -> int {
+                torch_npu::profiler::MstxRange range(
+                    getMstxHcclMsg("HcclAllreduce", numel, hcclType, comm, streamId), stream.stream(false),
+                    torch_npu::profiler::DOMAIN_COMMUNICATION);
+                auto hccl_result = HcclAllReduce(
+                    inputDataPtr, outputDataPtr, numel, hcclType, hcclReduceOp, comm, stream.stream(false));
+                *is_dispatched = true;
+                return hccl_result;
+            };
+            at_npu::native::OpCommand cmd;
+            cmd.Name("HcclAllreduce");
+            cmd.SetCustomHandler(hccl_call);
+            cmd.Run();
+
+            return HCCL_SUCCESS;
+        },
+        [&](std::vector<c10_npu::NPUStream>&, c10::intrusive_ptr<ProcessGroupHCCL::WorkHCCL>&) {},
+        [&](std::vector<c10_npu::NPUStream>& hcclStreams, c10::intrusive_ptr<ProcessGroupHCCL::WorkHCCL>& work) {
+            c10_npu::NPUStreamGuard guard(hcclStreams[0]);
+            for (const auto b : c10::irange(buckets.size())) {
+                if (opts.reduceOp == c10d::ReduceOp::AVG) {
+                    flats[b].div_(getSize());
+                }
+                auto pieces = flats[b].split_with_sizes(bucketNumels[b]);
+                std::vector<at::Tensor> dsts;
+                std::vector<at::Tensor> srcs;
+                for (const auto j : c10::irange(buckets[b].size())) {
+                    auto& tensor = tensors[buckets[b][j]];
+                    // See [Sync Streams].
+                    if (c10_npu::option::OptionsManager::GetMultiStreamMemoryReuse() == c10_npu::option::AVOID_RECORD_STREAM) {
+                        work->stashed_for_allocator_safety_.push_back(tensor);
+                    } else {
+                        c10_npu::NPUCachingAllocator::recordStream(tensor.storage().data_ptr(), hcclStreams[0]);
+                        if (c10_npu::option::OptionsManager::GetMultiStreamMemoryReuse() == c10_npu::option::ERASE_RECORD_STREAM) {
+                            work->recorded_outputs_.push_back(
+                                std::make_pair(tensor.storage().getWeakStorageImpl(), hcclStreams[0]));
+                        }
+                    }
+                    dsts.push_back(tensor);
+                    srcs.push_back(pieces[j].view(tensor.sizes()));
+                }
+                at::_foreach_copy_(dsts, srcs);
+                releaseEvents[b]->record(hcclStreams[0]);
+            }
+            // The flats are reused by the next call with the same layout, the
+            // results are the caller's tensors.
+            work->outputs_ = std::make_shared<std::vector<at::Tensor>>(tensors);
+        },
+        c10d::OpType::ALLREDUCE);
+}
+
 c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::allreduce_coalesced(
     std::vector<at::Tensor>& tensors,
     const c10d::AllreduceCoalescedOptions& opts)
 {
     check_npu_tensors_same_device(tensors);
+    // Opt-in fused mode, bool/uint8 tensors are cast per tensor and keep the
+    // unfused path.
+    static const uint64_t bucketCap =
+        static_cast<uint64_t>(c10_npu::option::OptionsManager::GetHcclCoalescedBucketCap()) * 1024 * 1024;
+    if (bucketCap > 0 && tensors.size() > 1 &&
+        std::all_of(tensors.begin(), tensors.end(), [](const at::Tensor& t) {
+            return t.scalar_type() != at::kBool && t.scalar_type() != at::kByte &&
+                at_npu::native::FormatHelper::IsBaseFormatType(t);
+        })) {
+        return allreduceCoalescedBucketed(tensors, opts, bucketCap);
+    }
     std::vector<at::Tensor> tensors_cp = tensors;
     std::string functionName = __FUNCTION__;
     auto streamId = getStreamId(false, -1);
@@ -3040,9 +3874,7 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::reduce(
 {
     check_npu_tensors_different_devices(tensors);
 
-    if (C10_UNLIKELY(at_npu::native::env::CheckOpHookEnable())) {
-        at_npu::native::OpHook::GetInstance().PreHook("reduce", tensors);
-    }
+    OpHookCollectiveScope opHookScope("reduce", tensors);
 
     std::string functionName = __FUNCTION__;
     uint64_t rank = opts.rootRank;
@@ -3361,13 +4193,117 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::allgather(
 {
     check_npu_tensors_different_devices(inputTensors);
 
-    if (C10_UNLIKELY(at_npu::native::env::CheckOpHookEnable())) {
-        at_npu::native::OpHook::GetInstance().PreHook("allgather", outputTensors, inputTensors);
-    }
+    OpHookCollectiveScope opHookScope("allgather", outputTensors, inputTensors);
 
+    TORCH_CHECK(outputTensors.back().size() == static_cast<size_t>(size_),
+        "Output tensor list size ", outputTensors.back().size(), " must equal the process group size ", size_,
+        DIST_ERROR(ErrCode::PARAM));
     auto inputTensors_ = cast_to_origin_format(inputTensors);
     bool same_size = check_same_size(outputTensors.back());
-    if (same_size) {
+    // When the output list already lives in one storage (e.g. chunks of a
+    // flat parameter), gather straight into it instead of staging through a
+    // flattened buffer and copying every chunk back.
+    std::vector<uint64_t> outputSpl;
+    at::Tensor outputBase;
+    bool zero_copy = inputTensors_[0].is_contiguous() &&
+        inputTensors_[0].scalar_type() == outputTensors.back()[0].scalar_type() &&
+        get_storage_displacements(outputTensors.back(), outputSpl, outputBase);
+    if (zero_copy && same_size &&
+        is_rank_ordered_layout(outputSpl, static_cast<uint64_t>(inputTensors_[0].numel()))) {
+        std::vector<at::Tensor> outputFlattened = {outputBase};
+        auto streamId = getStreamId(false, -1);
+        return collective(
+            inputTensors_,
+            outputFlattened,
+            [&](at::Tensor& input, at::Tensor& output, HcclComm comm, c10_npu::NPUStream& stream, std::shared_ptr<bool> is_dispatched) {
+                RECORD_FUNCTION("HcclAllgather", std::vector<c10::IValue>({input}));
+
+                if (c10_npu::option::OptionsManager::GetMultiStreamMemoryReuse() != c10_npu::option::AVOID_RECORD_STREAM) {
+                    c10_npu::NPUCachingAllocator::recordStream(output.storage().data_ptr(), stream);
+                }
+                auto inputDataPtr = input.data_ptr();
+                auto outputDataPtr = output.data_ptr();
+                auto numel = getNumelForHCCL(input);
+                auto hcclType = getHcclDataType(input.scalar_type());
+                auto hccl_call = [inputDataPtr, outputDataPtr, numel, hcclType, comm, stream, is_dispatched, streamId]() -> int {
+                    torch_npu::profiler::MstxRange range(
+                        getMstxHcclMsg("HcclAllGather", numel, hcclType, comm, streamId), stream.stream(false),
+                        torch_npu::profiler::DOMAIN_COMMUNICATION);
+                    auto hccl_result = HcclAllGather(inputDataPtr, outputDataPtr, numel, hcclType, comm, stream.stream(false));
+                    *is_dispatched = true;
+                    return hccl_result;
+                };
+                at_npu::native::OpCommand::RunOpApi("HcclAllgather", hccl_call);
+
+                return HCCL_SUCCESS;
+            },
+            [&](std::vector<c10_npu::NPUStream>&, c10::intrusive_ptr<ProcessGroupHCCL::WorkHCCL>&) {},
+            [&](std::vector<c10_npu::NPUStream>&, c10::intrusive_ptr<ProcessGroupHCCL::WorkHCCL>& work) {
+                // Results are the user's tensors, not the view spanning them.
+                work->outputs_ = std::make_shared<std::vector<at::Tensor>>(outputTensors.back());
+            },
+            c10d::OpType::ALLGATHER);
+    } else if (zero_copy && hcclAllGatherVExist()) {
+        std::vector<uint64_t> outputCounts;
+        for (const auto& t : outputTensors.back()) {
+            outputCounts.push_back(static_cast<uint64_t>(t.numel()));
+        }
+        TORCH_CHECK(outputCounts[rank_] == static_cast<uint64_t>(inputTensors_[0].numel()),
+            "Output tensor of rank ", rank_, " has ", outputCounts[rank_], " elements, but the input has ",
+            inputTensors_[0].numel(), DIST_ERROR(ErrCode::PARAM));
+        std::vector<at::Tensor> outputFlattened = {outputBase};
+        auto streamId = getStreamId(false, -1);
+        return collective(
+            inputTensors_,
+            outputFlattened,
+            [&](at::Tensor& input, at::Tensor& output, HcclComm comm, c10_npu::NPUStream& stream, std::shared_ptr<bool> is_dispatched) {
+                RECORD_FUNCTION("HcclAllGatherV", std::vector<c10::IValue>({input}));
+
+                if (c10_npu::option::OptionsManager::GetMultiStreamMemoryReuse() != c10_npu::option::AVOID_RECORD_STREAM) {
+                    c10_npu::NPUCachingAllocator::recordStream(output.storage().data_ptr(), stream);
+                }
+                auto inputDataPtr = input.data_ptr();
+                uint64_t inputCount = input.numel();
+                auto outputDataPtr = output.data_ptr();
+                auto numel = getNumelForHCCL(input);
+                auto hcclType = getHcclDataType(input.scalar_type());
+                auto hccl_call = [
+                    inputDataPtr,
+                    inputCount,
+                    outputDataPtr,
+                    outputCounts,
+                    outputSpl,
+                    hcclType,
+                    numel,
+                    comm,
+                    stream,
+                    is_dispatched,
+                    streamId]() -> int {
+                        torch_npu::profiler::MstxRange range(
+                            getMstxHcclMsg("HcclAllGatherV", numel, hcclType, comm, streamId),
+                            stream.stream(false), torch_npu::profiler::DOMAIN_COMMUNICATION);
+                        auto hccl_result = hcclAllGatherV(
+                            inputDataPtr,
+                            inputCount,
+                            outputDataPtr,
+                            outputCounts.data(),
+                            outputSpl.data(),
+                            hcclType,
+                            comm,
+                            stream.stream(false));
+                        *is_dispatched = true;
+                        return hccl_result;
+                };
+                at_npu::native::OpCommand::RunOpApi("HcclAllGatherV", hccl_call);
+
+                return HCCL_SUCCESS;
+            },
+            [&](std::vector<c10_npu::NPUStream>&, c10::intrusive_ptr<ProcessGroupHCCL::WorkHCCL>&) {},
+            [&](std::vector<c10_npu::NPUStream>&, c10::intrusive_ptr<ProcessGroupHCCL::WorkHCCL>& work) {
+                work->outputs_ = std::make_shared<std::vector<at::Tensor>>(outputTensors.back());
+            },
+            c10d::OpType::ALLGATHER);
+    } else if (same_size) {
         int outsize = static_cast<int>(outputTensors[0].size());
         uint64_t output_nums[outsize];
         for (const auto i : c10::irange(outputTensors.size())) {
@@ -3442,7 +4378,7 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::allgather(
     } else if (hcclAllGatherVExist() && !has_empty_tensor(outputTensors.back())) {
         std::vector<at::Tensor> lastOutputTensors = outputTensors.back();
         std::vector<uint64_t> outputCounts;
-        std::vector<uint64_t> outputSpl;
+        outputSpl.clear();
         outputSpl.push_back(0);
         for (size_t i = 0; i < lastOutputTensors.size(); i++) {
             outputCounts.push_back(lastOutputTensors[i].numel());
@@ -3623,9 +4559,7 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::allgather_togather(
     check_npu_tensors_different_devices(inputTensors);
     check_npu_tensors_different_devices(outputTensors);
 
-    if (C10_UNLIKELY(at_npu::native::env::CheckOpHookEnable())) {
-        at_npu::native::OpHook::GetInstance().PreHook("allgather_togather", outputTensors, inputTensors);
-    }
+    OpHookCollectiveScope opHookScope("allgather_togather", outputTensors, inputTensors);
 
     auto inputTensors_ = cast_to_origin_format(inputTensors);
     auto streamId = getStreamId(false, -1);
@@ -3674,9 +4608,7 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::_allgather_base(
     check_npu_tensors_different_devices(inputTensors);
     check_npu_tensors_different_devices(outputTensors);
 
-    if (C10_UNLIKELY(at_npu::native::env::CheckOpHookEnable())) {
-        at_npu::native::OpHook::GetInstance().PreHook("_allgather_base", outputTensors, inputTensors);
-    }
+    OpHookCollectiveScope opHookScope("_allgather_base", outputTensors, inputTensors);
 
     auto inputTensors_ = cast_to_origin_format(inputTensors);
     auto streamId = getStreamId(false, -1);
@@ -3716,12 +4648,128 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::reduce_scatter(
 {
     check_npu_tensors_different_devices(outputTensors);
 
-    if (C10_UNLIKELY(at_npu::native::env::CheckOpHookEnable())) {
-        at_npu::native::OpHook::GetInstance().PreHook("reduce_scatter", outputTensors, inputTensors);
-    }
+    OpHookCollectiveScope opHookScope("reduce_scatter", outputTensors, inputTensors);
+    TORCH_CHECK(inputTensors.back().size() == static_cast<size_t>(size_),
+        "Input tensor list size ", inputTensors.back().size(), " must equal the process group size ", size_,
+        DIST_ERROR(ErrCode::PARAM));
     auto streamId = getStreamId(false, -1);
     bool same_size = check_same_size(inputTensors.back());
-    if (same_size) {
+    // Read straight from the input list when it already lives in one storage,
+    // which saves staging every chunk into a flattened buffer first.
+    std::vector<uint64_t> inputSpl;
+    at::Tensor inputBase;
+    bool zero_copy = outputTensors[0].is_contiguous() &&
+        at_npu::native::FormatHelper::IsBaseFormatType(outputTensors[0]) &&
+        outputTensors[0].scalar_type() == inputTensors.back()[0].scalar_type() &&
+        get_storage_displacements(inputTensors.back(), inputSpl, inputBase);
+    if (zero_copy && same_size &&
+        is_rank_ordered_layout(inputSpl, static_cast<uint64_t>(outputTensors[0].numel()))) {
+        std::vector<at::Tensor> inputFlattened = {inputBase};
+        std::string functionName = __FUNCTION__;
+        return collective(
+            inputFlattened,
+            outputTensors,
+            [&](at::Tensor& input, at::Tensor& output, HcclComm comm, c10_npu::NPUStream& stream, std::shared_ptr<bool> is_dispatched) {
+                auto hcclType = getHcclDataType(input.scalar_type());
+                checkSupportedDataType(hcclType, functionName);
+                RECORD_FUNCTION("HcclReduceScatter", std::vector<c10::IValue>({input}));
+                if (c10_npu::option::OptionsManager::GetMultiStreamMemoryReuse() != c10_npu::option::AVOID_RECORD_STREAM) {
+                    c10_npu::NPUCachingAllocator::recordStream(output.storage().data_ptr(), stream);
+                }
+                auto inputDataPtr = input.data_ptr();
+                auto outputDataPtr = output.data_ptr();
+                auto numel = getNumelForHCCL(output);
+                auto hcclReduceOp = getHcclReduceOp(opts.reduceOp, input);
+                auto hccl_call = [inputDataPtr, outputDataPtr, numel, hcclType, hcclReduceOp, comm, stream, is_dispatched, streamId]() -> int {
+                    torch_npu::profiler::MstxRange range(
+                        getMstxHcclMsg("HcclReduceScatter", numel, hcclType, comm, streamId), stream.stream(false),
+                        torch_npu::profiler::DOMAIN_COMMUNICATION);
+                    auto hccl_result = HcclReduceScatter(
+                        inputDataPtr, outputDataPtr, numel, hcclType, hcclReduceOp, comm, stream.stream(false));
+                    *is_dispatched = true;
+                    return hccl_result;
+                };
+                at_npu::native::OpCommand::RunOpApi("HcclReduceScatter", hccl_call);
+
+                return HCCL_SUCCESS;
+            },
+            [&](std::vector<c10_npu::NPUStream>&, c10::intrusive_ptr<ProcessGroupHCCL::WorkHCCL>&) {},
+            [&](std::vector<c10_npu::NPUStream>& hcclStreams, c10::intrusive_ptr<ProcessGroupHCCL::WorkHCCL>&) {
+                if (opts.reduceOp == c10d::ReduceOp::AVG) {
+                    c10_npu::NPUStreamGuard guard(hcclStreams[0]);
+                    for (auto& tensor : outputTensors) {
+                        tensor.div_(getSize());
+                    }
+                }
+            },
+            c10d::OpType::REDUCE_SCATTER);
+    } else if (zero_copy && hcclReduceScatterVExist()) {
+        std::vector<uint64_t> inputCounts;
+        for (const auto& t : inputTensors.back()) {
+            inputCounts.push_back(static_cast<uint64_t>(t.numel()));
+        }
+        TORCH_CHECK(inputCounts[rank_] == static_cast<uint64_t>(outputTensors[0].numel()),
+            "Input tensor for rank ", rank_, " has ", inputCounts[rank_], " elements, but the output has ",
+            outputTensors[0].numel(), DIST_ERROR(ErrCode::PARAM));
+        std::vector<at::Tensor> inputFlattened = {inputBase};
+        return collective(
+            inputFlattened,
+            outputTensors,
+            [&](at::Tensor& input, at::Tensor& output, HcclComm comm, c10_npu::NPUStream& stream, std::shared_ptr<bool> is_dispatched) {
+                RECORD_FUNCTION("HcclReduceScatterV", std::vector<c10::IValue>({input}));
+                if (c10_npu::option::OptionsManager::GetMultiStreamMemoryReuse() != c10_npu::option::AVOID_RECORD_STREAM) {
+                    c10_npu::NPUCachingAllocator::recordStream(output.storage().data_ptr(), stream);
+                }
+                auto inputDataPtr = input.data_ptr();
+                auto outputDataPtr = output.data_ptr();
+                uint64_t outputCount = output.numel();
+                auto numel = getNumelForHCCL(output);
+                auto hcclReduceOp = getHcclReduceOp(opts.reduceOp, input);
+                auto hcclType = getHcclDataType(input.scalar_type());
+                auto hccl_call = [
+                    inputDataPtr,
+                    inputCounts,
+                    inputSpl,
+                    outputDataPtr,
+                    outputCount,
+                    hcclType,
+                    hcclReduceOp,
+                    numel,
+                    comm,
+                    stream,
+                    is_dispatched,
+                    streamId]() -> int {
+                        torch_npu::profiler::MstxRange range(
+                            getMstxHcclMsg("HcclReduceScatterV", numel, hcclType, comm, streamId),
+                            stream.stream(false), torch_npu::profiler::DOMAIN_COMMUNICATION);
+                        auto hccl_result = hcclReduceScatterV(
+                            inputDataPtr,
+                            inputCounts.data(),
+                            inputSpl.data(),
+                            outputDataPtr,
+                            outputCount,
+                            hcclType,
+                            hcclReduceOp,
+                            comm,
+                            stream.stream(false));
+                        *is_dispatched = true;
+                        return hccl_result;
+                };
+                at_npu::native::OpCommand::RunOpApi("HcclReduceScatterV", hccl_call);
+
+                return HCCL_SUCCESS;
+            },
+            [&](std::vector<c10_npu::NPUStream>&, c10::intrusive_ptr<ProcessGroupHCCL::WorkHCCL>&) {},
+            [&](std::vector<c10_npu::NPUStream>& hcclStreams, c10::intrusive_ptr<ProcessGroupHCCL::WorkHCCL>&) {
+                if (opts.reduceOp == c10d::ReduceOp::AVG) {
+                    c10_npu::NPUStreamGuard guard(hcclStreams[0]);
+                    for (auto& tensor : outputTensors) {
+                        tensor.div_(getSize());
+                    }
+                }
+            },
+            c10d::OpType::REDUCE_SCATTER);
+    } else if (same_size) {
         auto inputFlattened = flatten_for_scatter_gather(inputTensors, outputTensors, size_);
         check_npu_tensors_different_devices(inputFlattened);
     std::string functionName = __FUNCTION__;
@@ -3783,8 +4831,8 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::reduce_scatter(
         c10d::OpType::REDUCE_SCATTER);
     } else if (hcclReduceScatterVExist()) {
         std::vector<uint64_t> inputCounts;
-        std::vector<uint64_t> inputSpl;
         std::vector<at::Tensor> lastInputTensors = inputTensors.back();
+        inputSpl.clear();
         inputSpl.push_back(0);
         for (size_t i = 0; i < lastInputTensors.size(); i++) {
             inputCounts.push_back(lastInputTensors[i].numel());
@@ -3910,9 +4958,7 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::_reduce_scatter_base(
     auto inputs = std::vector<at::Tensor>{inputTensor};
     auto outputs = std::vector<at::Tensor>{outputTensor};
 
-    if (C10_UNLIKELY(at_npu::native::env::CheckOpHookEnable())) {
-        at_npu::native::OpHook::GetInstance().PreHook("_reduce_scatter_base", outputs, inputs);
-    }
+    OpHookCollectiveScope opHookScope("_reduce_scatter_base", outputs, inputs);
     auto streamId = getStreamId(false, -1);
     std::string functionName = __FUNCTION__;
     return collective(
@@ -4006,12 +5052,17 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::reduce_scatter_tensor_coalesced
 c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::barrier(const c10d::BarrierOptions& opts)
 {
     std::vector<at::Device> devices;
-    if (usedDeviceIdxs_.empty()) {
+    std::set<int> usedDeviceIdxs;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        usedDeviceIdxs = usedDeviceIdxs_;
+    }
+    if (usedDeviceIdxs.empty()) {
         auto numNPUs = c10_npu::device_count();
         int16_t deviceIdx = static_cast<int16_t>(rank_ % std::max(static_cast<int>(numNPUs), 1));
         devices.push_back(at::Device(c10::DeviceType::PrivateUse1));
     } else {
-        for (auto usedDeviceIdx : usedDeviceIdxs_) {
+        for (auto usedDeviceIdx : usedDeviceIdxs) {
             devices.push_back(at::Device(c10::DeviceType::PrivateUse1, usedDeviceIdx));
         }
     }
@@ -4037,11 +5088,137 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::barrier(const c10d::BarrierOpti
 }
 
 c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::gather(
-    std::vector<std::vector<at::Tensor>>& /* unused */,
-    std::vector<at::Tensor>& /* unused */,
-    const c10d::GatherOptions& /* unused */)
+    std::vector<std::vector<at::Tensor>>& outputTensors,
+    std::vector<at::Tensor>& inputTensors,
+    const c10d::GatherOptions& opts)
 {
-    throw std::runtime_error("ProcessGroupHCCL does not support gather" + DIST_ERROR(ErrCode::NOT_SUPPORT));
+    static auto invalidArgument = [](const std::string& msg) {
+        C10_THROW_ERROR(ValueError, "ProcessGroupHCCL::gather: " + msg);
+    };
+
+    c10d::assertRootRank(invalidArgument, opts.rootRank, size_);
+    check_npu_tensors_different_devices(inputTensors);
+    c10d::assertSingleElementInput(invalidArgument, inputTensors);
+
+    const bool isRoot = getRank() == opts.rootRank;
+    if (isRoot) {
+        if (outputTensors.size() != 1) {
+            std::stringstream ss;
+            ss << "requires a single-element output list containing a list with "
+                << getSize() << " tensors.";
+            invalidArgument(ss.str());
+        } else if (outputTensors[0].size() != static_cast<size_t>(getSize())) {
+            std::stringstream ss;
+            ss << "Incorrect output list size " << outputTensors[0].size()
+                << ". Output list size should be " << getSize()
+                << ", same as size of the process group.";
+            invalidArgument(ss.str());
+        }
+
+        // Receive counts are taken from each output tensor, so ranks may
+        // contribute tensors of different shapes as long as the root's output
+        // list matches them; only the root's own slot must match its input.
+        const auto& options = inputTensors[0].options();
+        c10d::assertSizesMatch(invalidArgument, inputTensors[0].sizes(), outputTensors[0], opts.rootRank);
+        for (const auto r : c10::irange(outputTensors[0].size())) {
+            c10d::assertTypeMatch(invalidArgument, options, outputTensors[0], r);
+            check_npu_single_tensor(outputTensors[0][r]);
+        }
+    } else {
+        // if not in the root rank, initialize outputTensors as empty place holder
+        // with an empty list
+        if (outputTensors.size() != 0) {
+            invalidArgument("requires empty output on non-root");
+        }
+    }
+
+    OpHookCollectiveScope opHookScope("gather", outputTensors, inputTensors);
+
+    // Gather is scheduled as a root-only receive: every non-root rank posts a
+    // single send to the root and the root posts size_ - 1 receives, all in one
+    // HcclBatchSendRecv call. Unlike the allgather fallback, only the root
+    // allocates and receives world_size buffers.
+    auto inputTensors_ = cast_to_origin_format(inputTensors);
+    std::vector<at::Tensor> outputTensors_;
+    if (isRoot) {
+        outputTensors_ = create_base_format_tensors(outputTensors[0]);
+    }
+    const auto root = static_cast<uint32_t>(opts.rootRank);
+    auto streamId = getStreamId(false, -1);
+    return collective(
+        inputTensors_,
+        inputTensors_,
+        [&](at::Tensor& input, at::Tensor& output, HcclComm comm, c10_npu::NPUStream& stream, std::shared_ptr<bool> is_dispatched) {
+            RECORD_FUNCTION("HcclGather", std::vector<c10::IValue>({input}));
+            std::vector<HcclSendRecvItem> sendRecvInfo;
+            if (isRoot) {
+                sendRecvInfo.reserve(outputTensors_.size());
+                for (const auto r : c10::irange(outputTensors_.size())) {
+                    if (r == root) {
+                        continue;
+                    }
+                    sendRecvInfo.push_back(HcclSendRecvItem{HcclSendRecvType::HCCL_RECV,
+                                                            outputTensors_[r].data_ptr(),
+                                                            getNumelForHCCL(outputTensors_[r]),
+                                                            getHcclDataType(outputTensors_[r].scalar_type()),
+                                                            static_cast<uint32_t>(r)});
+                }
+            } else {
+                sendRecvInfo.push_back(HcclSendRecvItem{HcclSendRecvType::HCCL_SEND,
+                                                        input.data_ptr(),
+                                                        getNumelForHCCL(input),
+                                                        getHcclDataType(input.scalar_type()),
+                                                        root});
+            }
+            if (sendRecvInfo.empty()) {
+                // Single rank group, the root already holds its own contribution.
+                *is_dispatched = true;
+                return HCCL_SUCCESS;
+            }
+            auto itemNum = static_cast<uint32_t>(sendRecvInfo.size());
+            auto numel = getNumelForHCCL(input);
+            auto hcclType = getHcclDataType(input.scalar_type());
+            auto hccl_call = [sendRecvInfo, itemNum, numel, hcclType, comm, stream, is_dispatched, streamId]() mutable -> int {
+                torch_npu::profiler::MstxRange range(
+                    getMstxHcclMsg("HcclGather", numel, hcclType, comm, streamId), stream.stream(false),
+                    torch_npu::profiler::DOMAIN_COMMUNICATION);
+                auto hccl_result = hcclBatchIsendIrecv(sendRecvInfo.data(), itemNum, comm, stream.stream(false));
+                *is_dispatched = true;
+                return hccl_result;
+            };
+            at_npu::native::OpCommand::RunOpApi("HcclGather", hccl_call);
+
+            return HCCL_SUCCESS;
+        },
+        [&](std::vector<c10_npu::NPUStream>& hcclStreams, c10::intrusive_ptr<ProcessGroupHCCL::WorkHCCL>&) {
+            // The root's own contribution never goes through HCCL.
+            if (isRoot) {
+                c10_npu::NPUStreamGuard guard(hcclStreams[0]);
+                outputTensors_[root].copy_(inputTensors_[0], true);
+            }
+        },
+        [&](std::vector<c10_npu::NPUStream>& hcclStreams, c10::intrusive_ptr<ProcessGroupHCCL::WorkHCCL>& work) {
+            if (!isRoot) {
+                return;
+            }
+            c10_npu::NPUStreamGuard guard(hcclStreams[0]);
+            for (const auto r : c10::irange(outputTensors_.size())) {
+                // See [Sync Streams].
+                if (c10_npu::option::OptionsManager::GetMultiStreamMemoryReuse() == c10_npu::option::AVOID_RECORD_STREAM) {
+                    work->stashed_for_allocator_safety_.push_back(outputTensors_[r]);
+                } else {
+                    c10_npu::NPUCachingAllocator::recordStream(outputTensors_[r].storage().data_ptr(), hcclStreams[0]);
+                    if (c10_npu::option::OptionsManager::GetMultiStreamMemoryReuse() == c10_npu::option::ERASE_RECORD_STREAM) {
+                        work->recorded_outputs_.push_back(
+                            std::make_pair(outputTensors_[r].storage().getWeakStorageImpl(), hcclStreams[0]));
+                    }
+                }
+                if (!at_npu::native::FormatHelper::IsBaseFormatType(outputTensors[0][r])) {
+                    outputTensors[0][r].copy_(outputTensors_[r], true);
+                }
+            }
+        },
+        c10d::OpType::GATHER);
 }
 
 c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::scatter(
@@ -4082,9 +5259,7 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::scatter(
         }
     }
 
-    if (C10_UNLIKELY(at_npu::native::env::CheckOpHookEnable())) {
-        at_npu::native::OpHook::GetInstance().PreHook("scatter", outputTensors, inputTensors);
-    }
+    OpHookCollectiveScope opHookScope("scatter", outputTensors, inputTensors);
 
     std::vector<at::Tensor> inputFlattened;
     if (getRank() == opts.rootRank) {
@@ -4151,9 +5326,7 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::send(std::vector<at::Tensor>& t
 {
     check_npu_tensors_different_devices(tensors);
 
-    if (C10_UNLIKELY(at_npu::native::env::CheckOpHookEnable())) {
-        at_npu::native::OpHook::GetInstance().PreHook("send", tensors);
-    }
+    OpHookCollectiveScope opHookScope("send", tensors);
     auto streamId = getStreamId(true, dstRank);
     auto tensors_ = cast_to_origin_format(tensors);
     auto ret = pointToPoint(
@@ -4183,9 +5356,7 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::recv(std::vector<at::Tensor>& t
 {
     check_npu_tensors_different_devices(tensors);
 
-    if (C10_UNLIKELY(at_npu::native::env::CheckOpHookEnable())) {
-        at_npu::native::OpHook::GetInstance().PreHook("recv", tensors);
-    }
+    OpHookCollectiveScope opHookScope("recv", tensors);
     auto streamId = getStreamId(true, srcRank);
     auto tensors_ = create_base_format_tensors(tensors);
     auto ret = pointToPoint(
@@ -4253,9 +5424,7 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::alltoall_base(
     std::vector<at::Tensor> inputTensors = {inputTensor};
     std::vector<at::Tensor> outputTensors = {outputTensor};
 
-    if (C10_UNLIKELY(at_npu::native::env::CheckOpHookEnable())) {
-        at_npu::native::OpHook::GetInstance().PreHook("alltoall_base", outputTensors, inputTensors);
-    }
+    OpHookCollectiveScope opHookScope("alltoall_base", outputTensors, inputTensors);
 
     auto inputTensors_ = cast_to_origin_format(inputTensors);
     auto outputTensors_ = cast_to_origin_format(outputTensors);
@@ -4440,6 +5609,148 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::alltoall_base(
     }
 }
 
+c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::alltoall_base_device_splits(
+    at::Tensor& outputTensor,
+    at::Tensor& inputTensor,
+    at::Tensor& outputSplitSizes,
+    at::Tensor& inputSplitSizes,
+    bool exchangeSplitSizes,
+    const c10d::AllToAllOptions& opts)
+{
+    check_npu_single_tensor(outputTensor);
+    check_npu_single_tensor(inputTensor);
+    int ranks = getSize();
+    TORCH_CHECK(ranks > 0, "Invalid rank count within current process group", ranks, DIST_ERROR(ErrCode::PARAM));
+    check_device_split_sizes(inputSplitSizes, inputTensor, ranks);
+    check_device_split_sizes(outputSplitSizes, outputTensor, ranks);
+    std::vector<at::Tensor> inputTensors = {inputTensor};
+    std::vector<at::Tensor> outputTensors = {outputTensor};
+
+    OpHookCollectiveScope opHookScope("alltoall_base_device_splits", outputTensors, inputTensors);
+
+    auto currentStream = c10_npu::getCurrentNPUStream(inputTensor.device().index());
+    if (exchangeSplitSizes) {
+        // One split size per peer, exchanged on the HCCL stream. The offsets below
+        // are computed on the current stream, so it waits for the exchange on device.
+        auto splitsIn = inputSplitSizes.contiguous();
+        auto splitsOut = outputSplitSizes.is_contiguous() ? outputSplitSizes : at::empty_like(outputSplitSizes);
+        std::vector<int64_t> equalSplits;
+        auto exchange = c10::static_intrusive_pointer_cast<WorkHCCL>(
+            alltoall_base(splitsOut, splitsIn, equalSplits, equalSplits, opts));
+        (*exchange->hcclEndEvents_)[0].block(currentStream);
+        if (!splitsOut.is_same(outputSplitSizes)) {
+            outputSplitSizes.copy_(splitsOut);
+        }
+    }
+
+    // Element counts and displacements of both sides, [4, ranks] on device.
+    int64_t inputRowSize = inputTensor.size(0) ? inputTensor.numel() / inputTensor.size(0) : 1;
+    int64_t outputRowSize = outputTensor.size(0) ? outputTensor.numel() / outputTensor.size(0) : 1;
+    auto inputCounts = inputSplitSizes.mul(inputRowSize);
+    auto outputCounts = outputSplitSizes.mul(outputRowSize);
+    auto deviceMeta = at::stack({inputCounts, inputCounts.cumsum(0).sub_(inputCounts),
+                                 outputCounts, outputCounts.cumsum(0).sub_(outputCounts)});
+    auto hostMeta = at::empty({4, ranks}, at::kLong).pin_memory();
+    hostMeta.copy_(deviceMeta, true);
+    // Only the counts are waited for, so that split sizes that do not fit the
+    // tensors raise here instead of failing the launch on the task queue.
+    c10_npu::NPUEvent metaReady;
+    metaReady.record(currentStream);
+    metaReady.synchronize();
+    const int64_t* meta = hostMeta.data_ptr<int64_t>();
+    uint64_t inputNumel = static_cast<uint64_t>(inputTensor.numel());
+    uint64_t outputNumel = static_cast<uint64_t>(outputTensor.numel());
+    // Checked one by one first, a negative count would wrap around in the sums.
+    for (int i = 0; i < ranks; ++i) {
+        int64_t inputCount = meta[i];
+        int64_t outputCount = meta[2 * ranks + i];
+        TORCH_CHECK(inputCount >= 0 && static_cast<uint64_t>(inputCount) <= inputNumel,
+                    "Invalid input split size for rank ", i, ": ", inputCount, " elements of ", inputNumel,
+                    DIST_ERROR(ErrCode::PARAM));
+        TORCH_CHECK(outputCount >= 0 && static_cast<uint64_t>(outputCount) <= outputNumel,
+                    "Invalid output split size for rank ", i, ": ", outputCount, " elements of ", outputNumel,
+                    DIST_ERROR(ErrCode::PARAM));
+    }
+    std::vector<uint64_t> inputCounts(meta, meta + ranks);
+    std::vector<uint64_t> inputSpl(meta + ranks, meta + 2 * ranks);
+    std::vector<uint64_t> outputCounts(meta + 2 * ranks, meta + 3 * ranks);
+    std::vector<uint64_t> outputSpl(meta + 3 * ranks, meta + 4 * ranks);
+    uint64_t inputTotal = c10::sum_integers(inputCounts);
+    uint64_t outputTotal = c10::sum_integers(outputCounts);
+    TORCH_CHECK(inputTotal <= inputNumel, "Split sizes of alltoallv exceed the input tensor: ", inputTotal,
+                " of ", inputNumel, " elements", DIST_ERROR(ErrCode::PARAM));
+    TORCH_CHECK(outputTotal <= outputNumel, "Split sizes of alltoallv exceed the output tensor: ", outputTotal,
+                " of ", outputNumel, " elements", DIST_ERROR(ErrCode::PARAM));
+
+    auto inputTensors_ = cast_to_origin_format(inputTensors);
+    auto outputTensors_ = cast_to_origin_format(outputTensors);
+    auto streamId = getStreamId(false, -1);
+    check_npu_tensors_different_devices(inputTensors);
+    check_npu_tensors_different_devices(outputTensors);
+    return collective(
+        inputTensors_,
+        outputTensors_,
+        [&](at::Tensor& input, at::Tensor& output, HcclComm comm, c10_npu::NPUStream& stream, std::shared_ptr<bool> is_dispatched) {
+            RECORD_FUNCTION("HcclAlltoAllV", std::vector<c10::IValue>({input}));
+            auto inputDataPtr = input.data_ptr();
+            auto outputDataPtr = output.data_ptr();
+            auto inputhcclDataType = getHcclDataType(input.scalar_type());
+            auto outputhcclDataType = getHcclDataType(output.scalar_type());
+            auto hccl_call = [inputDataPtr,
+                              inputCounts,
+                              inputSpl,
+                              inputhcclDataType,
+                              outputDataPtr,
+                              outputCounts,
+                              outputSpl,
+                              outputhcclDataType,
+                              ranks,
+                              comm,
+                              stream,
+                              is_dispatched,
+                              streamId]() -> int {
+                torch_npu::profiler::MstxRange range(
+                    getMstxHcclMsg("HcclAlltoAllV", static_cast<uint64_t>(ranks), inputhcclDataType, comm, streamId),
+                    stream.stream(false), torch_npu::profiler::DOMAIN_COMMUNICATION);
+                auto hccl_result = hcclAlltoAllV(
+                    inputDataPtr,
+                    inputCounts.data(),
+                    inputSpl.data(),
+                    inputhcclDataType,
+                    outputDataPtr,
+                    outputCounts.data(),
+                    outputSpl.data(),
+                    outputhcclDataType,
+                    comm,
+                    stream.stream(false));
+                *is_dispatched = true;
+                return hccl_result;
+            };
+            at_npu::native::OpCommand::RunOpApi("HcclAlltoAllV", hccl_call);
+
+            return HCCL_SUCCESS;
+        },
+        [&](std::vector<c10_npu::NPUStream>&, c10::intrusive_ptr<ProcessGroupHCCL::WorkHCCL>&) {},
+        [&](std::vector<c10_npu::NPUStream>& hcclStreams, c10::intrusive_ptr<ProcessGroupHCCL::WorkHCCL>& work) {
+            for (size_t i = 0; i < outputTensors_.size(); ++i) {
+                c10_npu::NPUStreamGuard guard(hcclStreams[i]);
+                if (c10_npu::option::OptionsManager::GetMultiStreamMemoryReuse() == c10_npu::option::AVOID_RECORD_STREAM) {
+                    work->stashed_for_allocator_safety_.push_back(outputTensors_[i]);
+                } else {
+                    c10_npu::NPUCachingAllocator::recordStream(outputTensors_[i].storage().data_ptr(), hcclStreams[i]);
+                    if (c10_npu::option::OptionsManager::GetMultiStreamMemoryReuse() == c10_npu::option::ERASE_RECORD_STREAM) {
+                        work->recorded_outputs_.push_back(
+                            std::make_pair(outputTensors_[i].storage().getWeakStorageImpl(), hcclStreams[i]));
+                    }
+                }
+                if (!at_npu::native::FormatHelper::IsBaseFormatType(outputTensors[i])) {
+                    outputTensors[i].copy_(outputTensors_[i], true);
+                }
+            }
+        },
+        c10d::OpType::ALLTOALL_BASE);
+}
+
 c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::alltoall(
     std::vector<at::Tensor>& output_tensors,
     std::vector<at::Tensor>& input_tensors,
@@ -4453,9 +5764,7 @@ c10::intrusive_ptr<c10d::Work> ProcessGroupHCCL::alltoall(
             "tensors must be on the same device", DIST_ERROR(ErrCode::PARAM));
     }
 
-    if (C10_UNLIKELY(at_npu::native::env::CheckOpHookEnable())) {
-        at_npu::native::OpHook::GetInstance().PreHook("alltoall", output_tensors, input_tensors);
-    }
+    OpHookCollectiveScope opHookScope("alltoall", output_tensors, input_tensors);
 
     std::vector<int64_t> output_split_sizes;
     std::vector<int64_t> input_split_sizes;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <mutex>
+#include <random>
 #include <thread>
 #include <unordered_map>
 #include <variant>
@@ -11,6 +12,7 @@
 
 #include "third_party/hccl/inc/hccl/hccl.h"
 #include "torch_npu/csrc/core/npu/interface/HcclInterface.h"
+#include "torch_npu/csrc/distributed/CollectiveStats.hpp"
 #include "torch_npu/csrc/distributed/HCCLUtils.hpp"
 #include "torch_npu/csrc/npu/Event.h"
 
@@ -56,6 +58,9 @@ enum WatchdogStatus {
     STOP = 2
 };
 
+// Wakes the watchdog of a process group when its work finishes.
+class WorkCompletionListener;
+
 #define SHOULD_CLEAN_UP(a) ((a) != NoHandling && (a) != SkipCleanUp)
 
 #define SHOULD_TEAR_DOWN(a) ((a) != NoHandling && (a) != CleanUpOnly)
@@ -105,7 +110,8 @@ public:
             int rank,
             c10d::OpType opType,
             uint64_t seq,
-            bool desyncDebug);
+            bool desyncDebug,
+            bool collectStats = false);
 
         WorkHCCL(const WorkHCCL& w);
 
@@ -177,6 +183,22 @@ public:
         // multiple npu devices.
         std::shared_ptr<std::vector<c10_npu::NPUEvent>> hcclEndEvents_;
 
+        // Timing events around the HCCL kernels of this work, only created when
+        // collective statistics are collected. The watchdog turns them into a
+        // latency sample once the work has completed.
+        std::shared_ptr<std::vector<c10_npu::NPUEvent>> statsStartEvents_;
+        std::shared_ptr<std::vector<c10_npu::NPUEvent>> statsEndEvents_;
+
+        // Payload and element type reported to the collective statistics.
+        uint64_t statsBytes_{0};
+        at::ScalarType statsDtype_{at::kByte};
+        // Set on the watchdog's copy once its latency has been recorded.
+        bool statsRecorded_{false};
+
+        // Whether OpHook sampled this collective, its PostHook runs on the
+        // first synchronize. Not copied, the watchdog's copies never hook.
+        bool opHookSampled_{false};
+
         // Tensors used for barrier op
         std::vector<at::Tensor> barrierTensors_;
 
@@ -386,7 +408,6 @@ public:
     c10::intrusive_ptr<c10d::Work> barrier(
         const c10d::BarrierOptions& opts = c10d::BarrierOptions()) override;
 
-    // Unsupported Ops
     c10::intrusive_ptr<c10d::Work> gather(
         std::vector<std::vector<at::Tensor>>& outputTensors,
         std::vector<at::Tensor>& inputTensors,
@@ -407,6 +428,7 @@ public:
         int srcRank,
         int tag) override;
 
+    // Unsupported Ops
     c10::intrusive_ptr<c10d::Work> recvAnysource(
         std::vector<at::Tensor>& tensors,
         int tag) override;
@@ -418,6 +440,21 @@ public:
         std::vector<int64_t>& inputSplitSizes,
         const c10d::AllToAllOptions& opts = c10d::AllToAllOptions()) override;
 
+    // alltoall_base with the split sizes given as int64 NPU tensors of group size
+    // elements, so that counts produced on device (e.g. MoE routing) need no host
+    // sync. With exchangeSplitSizes, outputSplitSizes is filled with the input
+    // split sizes of the peers first. Counts and displacements are computed on
+    // device, and the calling thread waits only for those to reach the host, then
+    // raises if they do not fit the tensors. outputTensor must be large enough
+    // for the received rows.
+    c10::intrusive_ptr<c10d::Work> alltoall_base_device_splits(
+        at::Tensor& outputTensor,
+        at::Tensor& inputTensor,
+        at::Tensor& outputSplitSizes,
+        at::Tensor& inputSplitSizes,
+        bool exchangeSplitSizes,
+        const c10d::AllToAllOptions& opts = c10d::AllToAllOptions());
+
     c10::intrusive_ptr<c10d::Work> alltoall(
         std::vector<at::Tensor>& output_tensors,
         std::vector<at::Tensor>& input_tensors,
@@ -438,6 +475,39 @@ public:
 
     int64_t getHcclComm(int rankid);
 
+    // Creates the HCCL communicator for `deviceIndex` the way the first collective
+    // on that device would. Returns the creation time in milliseconds, or 0 if the
+    // communicator already existed.
+    double initHcclCommEagerly(c10::DeviceIndex deviceIndex);
+
+    // Creates the communicators of several process groups on the current device
+    // concurrently, so that their root info exchanges through the store overlap
+    // instead of running one group after another. Groups are handed to at most
+    // maxWorkers threads (0 means one per group) in list order, so every rank must
+    // list the groups it belongs to in the same relative order. Returns the
+    // creation time of each group in milliseconds.
+    static std::vector<double> initHcclComms(
+        const std::vector<c10::intrusive_ptr<ProcessGroupHCCL>>& groups,
+        size_t maxWorkers = 0);
+
+    // Per (op type, dtype, size bucket) latency and bandwidth of the completed
+    // collectives of this group, measured with device timing events by the
+    // watchdog. Off by default, see TORCH_HCCL_COLLECTIVE_STATS. Toggling only
+    // affects works issued afterwards.
+    void setCollectiveStatsEnabled(bool enabled);
+
+    bool isCollectiveStatsEnabled() const;
+
+    // Also records the works that have completed but not been retired by the
+    // watchdog yet, so the statistics are current once the works are synchronized.
+    std::vector<CollectiveStatsRow> getCollectiveStats();
+
+    // Cost of one opType collective of this group fitted to its statistics,
+    // see CollectiveStats::fitLatencyModel.
+    bool fitCollectiveLatency(c10d::OpType opType, double& alphaUs, double& betaUsPerByte);
+
+    void resetCollectiveStats();
+
     void setHcclCommName(const std::string& hccl_comm_name);
 
     void resumeHcclComm(int device_id);
@@ -481,7 +551,7 @@ protected:
         int p2pRank = 0);
 
     // Get the data vol for HCCL operators.
-    void recordDataVol(std::string opName, const std::string dataVol, const int currRank,
+    void recordDataVol(c10d::OpType opType, uint64_t dataVol, const int currRank,
         std::vector<std::shared_ptr<HCCLComm>>& hcclComms);
 
     // Get the comm for HCCL operators.
@@ -563,6 +633,13 @@ protected:
     // Condition Variable for watchdog thread sleep
     std::condition_variable workMetaListCV_;
 
+    // Set under workMetaListMutex_ when some enqueued work has finished.
+    bool workCompleted_ = false;
+
+    // Registered with the completion poller for every enqueued work, null
+    // without the watchdog thread.
+    std::shared_ptr<WorkCompletionListener> completionListener_;
+
     // Condition variable to control how long the  watchdog thread waits.
     std::condition_variable watchdogCV_;
 
@@ -778,9 +855,40 @@ private:
 
     void silenceCheck(at::Tensor &input, c10d::OpType opType);
 
+    // Records the statistics start events of `work` on the HCCL streams and
+    // remembers its payload. No-op if the work does not collect statistics.
+    void recordCollectiveStatsStart(
+        c10::intrusive_ptr<WorkHCCL>& work,
+        std::vector<c10_npu::NPUStream>& hcclStreams,
+        const std::vector<at::Tensor>& inputs,
+        const std::vector<at::Tensor>& outputs);
+
+    void recordCollectiveStatsEnd(
+        c10::intrusive_ptr<WorkHCCL>& work,
+        std::vector<c10_npu::NPUStream>& hcclStreams);
+
+    // Called with workMetaListMutex_ held for completed works, records each work once.
+    void updateCollectiveStats(WorkHCCL& work);
+
+    // Records the enqueued works that have completed but not been retired yet.
+    void updateFinishedCollectiveStats();
+
+    // Whether the current collective input is one of the sampled ones, see
+    // NPU_ASD_CHECK_INTERVAL and NPU_ASD_SAMPLE_RATIO.
+    bool shouldSampleSilenceCheck();
+
+    // Fused allreduce_coalesced: packs same-dtype tensors into flat buckets of
+    // at most bucketCap bytes and issues one HcclAllReduce per bucket.
+    c10::intrusive_ptr<c10d::Work> allreduceCoalescedBucketed(
+        std::vector<at::Tensor>& tensors,
+        const c10d::AllreduceCoalescedOptions& opts,
+        uint64_t bucketCap);
+
     HcclCommConfig createHcclCommConfigWithOptions();
 
-    static std::string getMstxHcclMsg(const std::string &opName,
+    // Interned message, empty while the communication domain is disabled.
+    // opName must be a literal.
+    static const char *getMstxHcclMsg(const char *opName,
                                       uint64_t dataCnt,
                                       HcclDataType hcclType,
                                       HcclComm comm,
@@ -788,6 +896,32 @@ private:
 
     std::unordered_map<c10d::OpType, std::pair<at::Tensor, at::Tensor>> silenceCheckCache_;
 
+    // Silent check options, read once at construction instead of on every
+    // collective input.
+    struct SilenceCheckConfig {
+        uint32_t flag = 0;
+        std::pair<double, double> upperThresh;
+        std::pair<double, double> sigmaThresh;
+        uint32_t interval = 1;
+        double sampleRatio = 1.0;
+        bool useV3 = false;
+    };
+    SilenceCheckConfig silenceCheckConfig_;
+
+    std::atomic<bool> collectiveStatsEnabled_{false};
+    CollectiveStats collectiveStats_;
+    std::mt19937 silenceCheckRng_;
+    std::uniform_real_distribution<double> silenceCheckDist_{0.0, 1.0};
+
+    // Flat buffers of the fused allreduce_coalesced path, keyed by bucket
+    // layout. releaseEvent is recorded once the last collective using the
+    // buffer has unpacked it, and the next pack waits on it before reuse.
+    struct CoalescedBucket {
+        at::Tensor flat;
+        std::shared_ptr<c10_npu::NPUEvent> releaseEvent;
+    };
+    std::unordered_map<std::string, CoalescedBucket> coalescedBucketCache_;
+
     WatchdogStatus watchdogStatus;
 
     static ProcessGroupHCCL* global_;
@@ -1,4 +1,6 @@
-#include <c10d/default_comm_hooks.hpp>
+#include <limits>
+#include <tuple>
+
 #include <c10/core/ScalarType.h>
 #include <c10/util/Exception.h>
 
@@ -7,6 +9,7 @@
 #include <torch/torch.h>
 
 #include "torch_npu/csrc/core/npu/NPUException.h"
+#include "torch_npu/csrc/distributed/default_comm_hooks.hpp"
 
 namespace c10d {
 
@@ -52,3 +55,156 @@ c10::intrusive_ptr<c10::ivalue::Future> _AllReduceBySumCommHook::runHook(GradBuc
 }
 
 } // namespace c10d
+
+namespace c10d_npu {
+
+c10::intrusive_ptr<c10::ivalue::Future> BF16CompressCommHook::runHook(
+    c10d::GradBucket& bucket) {
+    // Like FP16CompressCommHook, the cast runs on the current stream rather than
+    // the HCCL stream: the hook only sees the ProcessGroup interface, and the
+    // collective already makes the HCCL stream wait for the current one, so the
+    // cast is ordered after the gradients it reads and before the allreduce.
+    auto compressed_tensor = bucket.getBufferRef().to(torch::kBFloat16);
+    // Divide before the allreduce, bf16 shares the fp32 exponent range so this is
+    // for parity with FP16CompressCommHook rather than overflow.
+    compressed_tensor /= state_->getSize();
+    std::vector<at::Tensor> tensors = {compressed_tensor};
+
+    auto allreduce_fut = state_->allreduce(tensors)->getFuture();
+    auto decompressed_tensor = bucket.getBufferRef();
+    auto decompress = [decompressed_tensor](c10::ivalue::Future& allreduce_fut) {
+        auto result = allreduce_fut.value();
+        TORCH_INTERNAL_ASSERT(
+            result.isTensorList(),
+            "ProcessGroup::allreduce should return TensorList", DIST_ERROR(ErrCode::INTERNAL));
+
+        auto reduce_tensor = result.toTensorVector()[0];
+        TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
+            reduce_tensor.scalar_type() == at::ScalarType::BFloat16,
+            "Expected reduced tensor to be bf16 in BF16CompressHook, but got type ",
+            reduce_tensor.scalar_type(), DIST_ERROR(ErrCode::TYPE)
+        );
+        // The bucket's gradients are views of the flat buffer, so decompressing
+        // in place updates them without another temporary.
+        decompressed_tensor.copy_(reduce_tensor);
+        return c10::IValue(decompressed_tensor);
+    };
+
+    return allreduce_fut->then(decompress, allreduce_fut->elementType());
+}
+
+namespace {
+
+// Lays out the quantized values and the scales of every shard in one int8 row, so
+// each exchange step is a single collective: [shards, shard_numel + 4 * shard_blocks].
+at::Tensor pack_quantized_shards(const at::Tensor& quantized, const at::Tensor& scales, int64_t shards)
+{
+    auto q_rows = quantized.view({shards, -1});
+    auto scale_rows = scales.view({shards, -1}).view(at::kChar);
+    return at::cat({q_rows, scale_rows}, 1);
+}
+
+std::tuple<at::Tensor, at::Tensor> unpack_quantized_shards(const at::Tensor& packed, int64_t shard_numel)
+{
+    auto quantized = packed.narrow(1, 0, shard_numel).contiguous().view(-1);
+    auto scales = packed.narrow(1, shard_numel, packed.size(1) - shard_numel).contiguous().view(at::kFloat).view(-1);
+    return std::make_tuple(quantized, scales);
+}
+
+} // namespace
+
+std::tuple<at::Tensor, at::Tensor> blockwise_quantize_int8(const at::Tensor& input, int64_t block_size)
+{
+    TORCH_CHECK(block_size > 0 && input.numel() % block_size == 0,
+        "blockwise_quantize_int8 expects numel to be a multiple of block_size, got numel ", input.numel(),
+        " and block_size ", block_size, DIST_ERROR(ErrCode::PARAM));
+    auto blocks = input.reshape({-1, block_size}).to(at::kFloat);
+    auto scales = blocks.abs().amax(1).div_(127.0);
+    // All-zero blocks keep a zero scale, dividing by the clamped scale still yields 0.
+    auto quantized = blocks.div(scales.clamp_min(std::numeric_limits<float>::min()).unsqueeze(1))
+        .round_()
+        .clamp_(-127, 127)
+        .to(at::kChar)
+        .view(-1);
+    return std::make_tuple(quantized, scales);
+}
+
+at::Tensor blockwise_dequantize_int8(const at::Tensor& quantized, const at::Tensor& scales, int64_t block_size)
+{
+    TORCH_CHECK(block_size > 0 && quantized.numel() == scales.numel() * block_size,
+        "blockwise_dequantize_int8 expects one scale per block of ", block_size, " values, got ",
+        quantized.numel(), " values and ", scales.numel(), " scales", DIST_ERROR(ErrCode::PARAM));
+    return quantized.reshape({-1, block_size}).to(at::kFloat).mul_(scales.reshape({-1, 1})).view(-1);
+}
+
+c10::intrusive_ptr<c10::ivalue::Future> BlockwiseInt8CompressCommHook::runHook(
+    c10d::GradBucket& bucket) {
+    auto buffer = bucket.getBufferRef();
+    const int64_t world_size = state_->getSize();
+    const int64_t block_size = block_size_;
+    const int64_t numel = buffer.numel();
+    const int64_t chunk = world_size * block_size;
+    const int64_t padded_numel = (numel + chunk - 1) / chunk * chunk;
+    const int64_t shard_numel = padded_numel / world_size;
+
+    auto input = at::zeros({padded_numel}, buffer.options().dtype(at::kFloat));
+    input.narrow(0, 0, numel).copy_(buffer.view(-1));
+    if (error_feedback_) {
+        auto& residual = residuals_[bucket.getIndex()];
+        // Buckets may be rebuilt after the first iteration, drop a stale residual.
+        if (residual.defined() && residual.numel() == padded_numel) {
+            input.add_(residual);
+        }
+    }
+
+    at::Tensor quantized;
+    at::Tensor scales;
+    std::tie(quantized, scales) = blockwise_quantize_int8(input, block_size);
+    if (error_feedback_) {
+        residuals_[bucket.getIndex()] = input.sub_(blockwise_dequantize_int8(quantized, scales, block_size));
+    }
+
+    // Reduce-scatter: rank r receives shard r of every peer.
+    auto send = pack_quantized_shards(quantized, scales, world_size);
+    auto recv = at::empty_like(send);
+    std::vector<int64_t> equal_splits;
+    auto scatter_fut = state_->alltoall_base(recv, send, equal_splits, equal_splits)->getFuture();
+
+    auto state = state_;
+    auto reduce_and_gather = [state, recv, world_size, shard_numel, block_size](c10::ivalue::Future& fut) {
+        fut.value();
+        at::Tensor peer_quantized;
+        at::Tensor peer_scales;
+        std::tie(peer_quantized, peer_scales) = unpack_quantized_shards(recv, shard_numel);
+        auto partial = blockwise_dequantize_int8(peer_quantized, peer_scales, block_size)
+            .view({world_size, shard_numel})
+            .sum(0)
+            .div_(world_size);
+
+        at::Tensor shard_quantized;
+        at::Tensor shard_scales;
+        std::tie(shard_quantized, shard_scales) = blockwise_quantize_int8(partial, block_size);
+        auto shard = pack_quantized_shards(shard_quantized, shard_scales, 1).view(-1);
+        auto gathered = at::empty({world_size * shard.numel()}, shard.options());
+        return state->_allgather_base(gathered, shard)->getFuture();
+    };
+    auto gather_fut = scatter_fut->thenAsync(reduce_and_gather, scatter_fut->elementType());
+
+    auto decompress = [buffer, world_size, shard_numel, numel, block_size](c10::ivalue::Future& fut) {
+        auto result = fut.value();
+        TORCH_INTERNAL_ASSERT(
+            result.isTensorList(),
+            "ProcessGroup::_allgather_base should return TensorList", DIST_ERROR(ErrCode::INTERNAL));
+        auto gathered = result.toTensorVector()[0].view({world_size, -1});
+        at::Tensor all_quantized;
+        at::Tensor all_scales;
+        std::tie(all_quantized, all_scales) = unpack_quantized_shards(gathered, shard_numel);
+        auto reduced = blockwise_dequantize_int8(all_quantized, all_scales, block_size);
+        buffer.view(-1).copy_(reduced.narrow(0, 0, numel));
+        return c10::IValue(buffer);
+    };
+
+    return gather_fut->then(decompress, gather_fut->elementType());
+}
+
+} // namespace c10d_npu
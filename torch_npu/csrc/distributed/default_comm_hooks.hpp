@@ -1,48 +1,66 @@
 #pragma once
 
+#include <tuple>
+#include <unordered_map>
+
 #include <c10d/ProcessGroup.hpp>
 #include <c10d/comm.hpp>
+#include <c10d/default_comm_hooks.hpp>
 
-namespace c10d {
+namespace c10d_npu {
 
+// Built-in communication hooks that only exist in torch_npu. c10d::BuiltinCommHookType
+// is owned by PyTorch and cannot be extended, so these are registered through an
+// overload of `_register_builtin_comm_hook` taking this enum instead.
 enum class BuiltinCommHookType {
-    ALLREDUCE = 1,
-    FP16_COMPRESS = 2,
+    BF16_COMPRESS = 1,
+    BLOCKWISE_INT8_COMPRESS = 2,
+    BLOCKWISE_INT8_COMPRESS_WITH_ERROR_FEEDBACK = 3,
 };
 
-class AllReduceCommHook : public CppCommHookInterface<c10::intrusive_ptr<ProcessGroup>> {
-public:
-    explicit AllReduceCommHook(c10::intrusive_ptr<ProcessGroup> state)
-        : CppCommHookInterface<c10::intrusive_ptr<ProcessGroup>>(state) {}
+constexpr int64_t kDefaultQuantBlockSize = 256;
 
-    ~AllReduceCommHook() override = default;
+// Quantizes a 1-D tensor whose numel is a multiple of block_size to int8 with one
+// fp32 scale (absmax / 127) per block. Only ATen ops are used, so on CPU tensors
+// this is also the reference implementation for tests.
+std::tuple<at::Tensor, at::Tensor> blockwise_quantize_int8(const at::Tensor& input, int64_t block_size);
 
-    c10::intrusive_ptr<c10::ivalue::Future> runHook(GradBucket& bucket) override;
-};
+// Inverse of blockwise_quantize_int8, returns a 1-D fp32 tensor.
+at::Tensor blockwise_dequantize_int8(const at::Tensor& quantized, const at::Tensor& scales, int64_t block_size);
 
-class FP16CompressCommHook : public CppCommHookInterface<c10::intrusive_ptr<ProcessGroup>> {
+class BF16CompressCommHook : public c10d::CppCommHookInterface<c10::intrusive_ptr<c10d::ProcessGroup>> {
 public:
-    explicit FP16CompressCommHook(c10::intrusive_ptr<ProcessGroup> state)
-        : CppCommHookInterface<c10::intrusive_ptr<ProcessGroup>>(state) {}
+    explicit BF16CompressCommHook(c10::intrusive_ptr<c10d::ProcessGroup> state)
+        : c10d::CppCommHookInterface<c10::intrusive_ptr<c10d::ProcessGroup>>(state) {}
 
-    ~FP16CompressCommHook() override = default;
+    ~BF16CompressCommHook() override = default;
 
-    c10::intrusive_ptr<c10::ivalue::Future> runHook(GradBucket& bucket) override;
+    c10::intrusive_ptr<c10::ivalue::Future> runHook(c10d::GradBucket& bucket) override;
 };
 
-// Almost same as AllReduceCommHook, but without division inside the hook.
-// This enables the optimization of fusing copy and division and saves one scan
-// over all the input parameters, when no communication hook is provided by the user.
-// Only used internally and not released as a public built-in communication hook.
-class _AllReduceBySumCommHook
-    : public CppCommHookInterface<c10::intrusive_ptr<ProcessGroup>> {
+// Averages the bucket with int8 blockwise quantization on the wire. The exchange
+// is a reduce-scatter (alltoall of quantized shards, summed in fp32 locally)
+// followed by an all-gather of the re-quantized partial sums. With error feedback
+// the local quantization error is kept per bucket and added to the next step.
+class BlockwiseInt8CompressCommHook : public c10d::CppCommHookInterface<c10::intrusive_ptr<c10d::ProcessGroup>> {
 public:
-    explicit _AllReduceBySumCommHook(c10::intrusive_ptr<ProcessGroup> state)
-        : CppCommHookInterface<c10::intrusive_ptr<ProcessGroup>>(state) {}
+    BlockwiseInt8CompressCommHook(
+        c10::intrusive_ptr<c10d::ProcessGroup> state,
+        bool error_feedback,
+        int64_t block_size = kDefaultQuantBlockSize)
+        : c10d::CppCommHookInterface<c10::intrusive_ptr<c10d::ProcessGroup>>(state),
+          error_feedback_(error_feedback),
+          block_size_(block_size) {}
+
+    ~BlockwiseInt8CompressCommHook() override = default;
 
-    ~_AllReduceBySumCommHook() override = default;
+    c10::intrusive_ptr<c10::ivalue::Future> runHook(c10d::GradBucket& bucket) override;
 
-    c10::intrusive_ptr<c10::ivalue::Future> runHook(GradBucket& bucket) override;
+private:
+    bool error_feedback_;
+    int64_t block_size_;
+    // Bucket index -> fp32 residual of the padded bucket.
+    std::unordered_map<size_t, at::Tensor> residuals_;
 };
 
-} // namespace c10d
+} // namespace c10d_npu
@@ -0,0 +1,266 @@
+#include <ATen/CPUGeneratorImpl.h>
+#include <torch/torch.h>
+
+#include "torch_npu/csrc/core/npu/NPUException.h"
+#include "torch_npu/csrc/distributed/powersgd_comm_hook.hpp"
+
+namespace c10d_npu {
+
+namespace {
+
+constexpr double kOrthogonalizationEpsilon = 1e-8;
+const std::string kIterKey = "iter";
+const std::string kErrorPrefix = "error.";
+const std::string kQMemoryPrefix = "q_memory.";
+
+// Views into the bucket buffer and into the per-bucket P / Q memories, computed once
+// per hook invocation and shared by the two allreduce callbacks.
+struct BucketFactors {
+    std::vector<at::Tensor> uncompressed;
+    std::vector<at::Tensor> matrices;
+    std::vector<at::Tensor> ps;
+    std::vector<at::Tensor> qs;
+    at::Tensor p_memory;
+    at::Tensor q_memory;
+};
+
+bool should_compress(int64_t rows, int64_t cols, int64_t rank, double min_compression_rate)
+{
+    return static_cast<double>((rows + cols) * rank) * min_compression_rate < static_cast<double>(rows * cols);
+}
+
+// Gram-Schmidt over the columns of a (rows, rank) matrix, in place.
+void orthogonalize(at::Tensor& matrix)
+{
+    const int64_t cols = matrix.size(1);
+    for (int64_t i = 0; i < cols; ++i) {
+        auto col = matrix.narrow(1, i, 1);
+        col.div_(at::norm(col, 2, {0}, true).add_(kOrthogonalizationEpsilon));
+        if (i + 1 < cols) {
+            auto rest = matrix.narrow(1, i + 1, cols - i - 1);
+            rest.sub_(at::sum(col * rest, {0}, true) * col);
+        }
+    }
+}
+
+at::Tensor to_device(const at::Tensor& tensor, const at::Tensor& like)
+{
+    return tensor.device() == like.device() ? tensor : tensor.to(like.device());
+}
+
+size_t parse_bucket_index(const std::string& key, const std::string& prefix)
+{
+    return static_cast<size_t>(std::stoull(key.substr(prefix.size())));
+}
+
+} // namespace
+
+PowerSGDState::PowerSGDState(
+    c10::intrusive_ptr<c10d::ProcessGroup> process_group,
+    int64_t matrix_approximation_rank,
+    int64_t start_powerSGD_iter,
+    double min_compression_rate,
+    bool use_error_feedback,
+    bool warm_start,
+    int64_t random_seed)
+    : process_group(std::move(process_group)),
+      matrix_approximation_rank(matrix_approximation_rank),
+      start_powerSGD_iter(start_powerSGD_iter),
+      min_compression_rate(min_compression_rate),
+      use_error_feedback(use_error_feedback),
+      warm_start(warm_start),
+      random_seed(random_seed),
+      rng(at::make_generator<at::CPUGeneratorImpl>(static_cast<uint64_t>(random_seed)))
+{
+    TORCH_CHECK(matrix_approximation_rank > 0,
+        "PowerSGD matrix_approximation_rank must be positive, got ", matrix_approximation_rank,
+        DIST_ERROR(ErrCode::VALUE));
+    // Same constraint as the Python hook: error feedback needs at least one vanilla
+    // allreduce step so that the DDP buckets are rebuilt before errors are recorded.
+    TORCH_CHECK(!use_error_feedback || start_powerSGD_iter > 1,
+        "Expect `start_powerSGD_iter` > 1 if `use_error_feedback` is True, got ", start_powerSGD_iter,
+        DIST_ERROR(ErrCode::VALUE));
+}
+
+std::unordered_map<std::string, at::Tensor> PowerSGDState::state_dict() const
+{
+    std::unordered_map<std::string, at::Tensor> state;
+    state.emplace(kIterKey, at::scalar_tensor(iter, at::kLong));
+    for (const auto& kv : error_dict) {
+        state.emplace(kErrorPrefix + std::to_string(kv.first), kv.second.cpu());
+    }
+    for (const auto& kv : q_memory_dict) {
+        state.emplace(kQMemoryPrefix + std::to_string(kv.first), kv.second.cpu());
+    }
+    return state;
+}
+
+void PowerSGDState::load_state_dict(const std::unordered_map<std::string, at::Tensor>& state)
+{
+    error_dict.clear();
+    p_memory_dict.clear();
+    q_memory_dict.clear();
+    for (const auto& kv : state) {
+        if (kv.first == kIterKey) {
+            iter = kv.second.item<int64_t>();
+        } else if (kv.first.compare(0, kErrorPrefix.size(), kErrorPrefix) == 0) {
+            error_dict[parse_bucket_index(kv.first, kErrorPrefix)] = kv.second;
+        } else if (kv.first.compare(0, kQMemoryPrefix.size(), kQMemoryPrefix) == 0) {
+            q_memory_dict[parse_bucket_index(kv.first, kQMemoryPrefix)] = kv.second;
+        } else {
+            TORCH_CHECK(false, "Unexpected key in PowerSGD state: ", kv.first, DIST_ERROR(ErrCode::PARAM));
+        }
+    }
+}
+
+c10::intrusive_ptr<c10::ivalue::Future> PowerSGDCommHook::runHook(c10d::GradBucket& bucket)
+{
+    auto state = state_;
+    auto process_group = state->process_group;
+    const int64_t world_size = process_group->getSize();
+    auto input = bucket.getBufferRef();
+    const size_t bucket_index = bucket.getIndex();
+
+    const bool compress = state->iter >= state->start_powerSGD_iter;
+    if (bucket.isLast()) {
+        state->iter++;
+    }
+    if (!compress) {
+        std::vector<at::Tensor> tensors = {input};
+        tensors[0] /= world_size;
+        return process_group->allreduce(tensors)->getFuture();
+    }
+
+    at::Tensor input_copy;
+    if (state->use_error_feedback) {
+        auto& error = state->error_dict[bucket_index];
+        // The first compressed step, or the buckets have been rebuilt since.
+        if (!error.defined() || error.numel() != input.numel()) {
+            error = at::zeros_like(input);
+        } else {
+            error = to_device(error, input);
+            input.add_(error);
+        }
+        input_copy = input.clone();
+    }
+
+    auto factors = std::make_shared<BucketFactors>();
+    int64_t uncompressed_numel = 0;
+    int64_t total_p_numel = 0;
+    int64_t total_q_numel = 0;
+    std::vector<int64_t> ranks;
+    for (auto& grad : bucket.getGradients()) {
+        if (grad.dim() > 1) {
+            const int64_t rows = grad.size(0);
+            const int64_t cols = grad.numel() / rows;
+            const int64_t rank = std::min({rows, cols, state->matrix_approximation_rank});
+            if (should_compress(rows, cols, rank, state->min_compression_rate)) {
+                factors->matrices.push_back(grad.view({rows, cols}));
+                ranks.push_back(rank);
+                total_p_numel += rows * rank;
+                total_q_numel += cols * rank;
+                continue;
+            }
+        }
+        factors->uncompressed.push_back(grad);
+        uncompressed_numel += grad.numel();
+    }
+
+    if (factors->matrices.empty()) {
+        // Nothing in this bucket is worth compressing, PowerSGD degrades to a plain
+        // allreduce and there is no approximation error to carry over.
+        if (state->use_error_feedback) {
+            state->error_dict[bucket_index].zero_();
+        }
+        std::vector<at::Tensor> tensors = {input};
+        tensors[0] /= world_size;
+        return process_group->allreduce(tensors)->getFuture();
+    }
+
+    // The uncompressed tensors ride in front of the P factors, so they share the
+    // first allreduce instead of paying for a separate launch.
+    auto& p_memory = state->p_memory_dict[bucket_index];
+    if (!p_memory.defined() || p_memory.numel() != uncompressed_numel + total_p_numel) {
+        p_memory = at::empty({uncompressed_numel + total_p_numel}, input.options());
+    }
+    auto& q_memory = state->q_memory_dict[bucket_index];
+    bool randomize_qs = !state->warm_start || !q_memory.defined() || q_memory.numel() != total_q_numel;
+    if (randomize_qs) {
+        // Generated on CPU from the shared seed so that every rank starts from the same Q.
+        q_memory = at::randn({total_q_numel}, state->rng, at::TensorOptions().dtype(at::kFloat))
+            .to(input.options());
+    } else {
+        q_memory = to_device(q_memory, input);
+    }
+    factors->p_memory = p_memory;
+    factors->q_memory = q_memory;
+
+    int64_t p_offset = uncompressed_numel;
+    int64_t q_offset = 0;
+    for (size_t i = 0; i < factors->matrices.size(); ++i) {
+        const auto& matrix = factors->matrices[i];
+        const int64_t rows = matrix.size(0);
+        const int64_t cols = matrix.size(1);
+        factors->ps.push_back(p_memory.narrow(0, p_offset, rows * ranks[i]).view({rows, ranks[i]}));
+        factors->qs.push_back(q_memory.narrow(0, q_offset, cols * ranks[i]).view({cols, ranks[i]}));
+        p_offset += rows * ranks[i];
+        q_offset += cols * ranks[i];
+    }
+
+    if (uncompressed_numel > 0) {
+        std::vector<at::Tensor> flat_uncompressed;
+        flat_uncompressed.reserve(factors->uncompressed.size());
+        for (const auto& tensor : factors->uncompressed) {
+            flat_uncompressed.push_back(tensor.reshape({-1}));
+        }
+        auto head = p_memory.narrow(0, 0, uncompressed_numel);
+        at::cat_out(head, flat_uncompressed, 0);
+    }
+    for (size_t i = 0; i < factors->matrices.size(); ++i) {
+        // A warm-started Q, whether kept from the previous step or restored from a
+        // checkpoint, is the allreduced one and no longer orthonormal.
+        orthogonalize(factors->qs[i]);
+        at::mm_out(factors->ps[i], factors->matrices[i], factors->qs[i]);
+    }
+
+    std::vector<at::Tensor> p_tensors = {p_memory};
+    auto p_fut = process_group->allreduce(p_tensors)->getFuture();
+
+    auto compute_qs = [factors, process_group, world_size, uncompressed_numel](c10::ivalue::Future& fut) {
+        fut.value();
+        if (uncompressed_numel > 0) {
+            auto head = factors->p_memory.narrow(0, 0, uncompressed_numel).div_(world_size);
+            int64_t offset = 0;
+            for (auto& tensor : factors->uncompressed) {
+                tensor.copy_(head.narrow(0, offset, tensor.numel()).view_as(tensor));
+                offset += tensor.numel();
+            }
+        }
+        for (size_t i = 0; i < factors->matrices.size(); ++i) {
+            orthogonalize(factors->ps[i]);
+            at::mm_out(factors->qs[i], factors->matrices[i].t(), factors->ps[i]);
+        }
+        std::vector<at::Tensor> q_tensors = {factors->q_memory};
+        return process_group->allreduce(q_tensors)->getFuture();
+    };
+    auto q_fut = p_fut->thenAsync(compute_qs, p_fut->elementType());
+
+    // The callbacks may run on another thread while later buckets are hooked, so
+    // they only touch tensors captured here and never the state maps.
+    at::Tensor error = state->use_error_feedback ? state->error_dict[bucket_index] : at::Tensor();
+    auto decompress = [factors, input, input_copy, error, world_size](c10::ivalue::Future& fut) {
+        fut.value();
+        factors->q_memory.div_(world_size);
+        for (size_t i = 0; i < factors->matrices.size(); ++i) {
+            at::mm_out(factors->matrices[i], factors->ps[i], factors->qs[i].t());
+        }
+        if (error.defined()) {
+            at::sub_out(error, input_copy, input);
+        }
+        return c10::IValue(input);
+    };
+
+    return q_fut->then(decompress, q_fut->elementType());
+}
+
+} // namespace c10d_npu
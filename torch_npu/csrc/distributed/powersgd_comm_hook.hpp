@@ -0,0 +1,66 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include <ATen/core/Generator.h>
+#include <c10d/ProcessGroup.hpp>
+#include <c10d/comm.hpp>
+
+namespace c10d_npu {
+
+// State of the native PowerSGD hook, shared between the hook owned by the reducer
+// and the Python object used to configure and checkpoint it. Mirrors the subset of
+// torch.distributed.algorithms.ddp_comm_hooks.powerSGD_hook.PowerSGDState that the
+// C++ hook implements.
+struct PowerSGDState {
+    PowerSGDState(
+        c10::intrusive_ptr<c10d::ProcessGroup> process_group,
+        int64_t matrix_approximation_rank = 1,
+        int64_t start_powerSGD_iter = 1000,
+        double min_compression_rate = 2,
+        bool use_error_feedback = true,
+        bool warm_start = true,
+        int64_t random_seed = 0);
+
+    // Returns the per-bucket error and Q memories (as CPU tensors) and the iteration
+    // counter, in a form that can be saved together with the model checkpoint.
+    std::unordered_map<std::string, at::Tensor> state_dict() const;
+
+    // Restores a state_dict(). Tensors are moved to the bucket device on first use.
+    void load_state_dict(const std::unordered_map<std::string, at::Tensor>& state);
+
+    c10::intrusive_ptr<c10d::ProcessGroup> process_group;
+    int64_t matrix_approximation_rank;
+    int64_t start_powerSGD_iter;
+    double min_compression_rate;
+    bool use_error_feedback;
+    bool warm_start;
+    int64_t random_seed;
+
+    // Seeds the initial Q factors, identical on all ranks.
+    at::Generator rng;
+    int64_t iter = 0;
+    // Bucket index -> compensated gradient error from the previous step.
+    std::unordered_map<size_t, at::Tensor> error_dict;
+    // Bucket index -> flat P / Q factors of all compressed tensors in the bucket.
+    // Without warm start Q is regenerated every step and only the buffer is reused.
+    std::unordered_map<size_t, at::Tensor> p_memory_dict;
+    std::unordered_map<size_t, at::Tensor> q_memory_dict;
+};
+
+// Rank-r PowerSGD (Vogels et al., 2019) with error feedback and warm start. Per
+// bucket it issues one allreduce for the P factors, which also carries the tensors
+// that are not worth compressing, and one allreduce for the Q factors.
+class PowerSGDCommHook : public c10d::CppCommHookInterface<std::shared_ptr<PowerSGDState>> {
+public:
+    explicit PowerSGDCommHook(std::shared_ptr<PowerSGDState> state)
+        : c10d::CppCommHookInterface<std::shared_ptr<PowerSGDState>>(std::move(state)) {}
+
+    ~PowerSGDCommHook() override = default;
+
+    c10::intrusive_ptr<c10::ivalue::Future> runHook(c10d::GradBucket& bucket) override;
+};
+
+} // namespace c10d_npu
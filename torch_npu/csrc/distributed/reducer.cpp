@@ -16,6 +16,7 @@
 
 
 #include <functional>
+#include <limits>
 
 #include <c10/core/DeviceGuard.h>
 #include <c10/core/StreamGuard.h>
@@ -55,6 +56,62 @@ c10d::DebugLevel g_debug_level = c10d::DebugLevel::Off;
 c10d::DebugLevel debug_level() noexcept {
     return g_debug_level;
 }
+
+// Fits the cost of one allreduce to the latencies the HCCL backend recorded for
+// the past works of the group. Needs collective statistics to be enabled, see
+// ProcessGroupHCCL::setCollectiveStatsEnabled.
+bool fit_allreduce_cost(
+    const c10::intrusive_ptr<c10d::ProcessGroup>& process_group,
+    double& alpha_ns,
+    double& beta_ns_per_byte) {
+    c10::intrusive_ptr<c10d::Backend> backend;
+    try {
+        backend = process_group->getBackend(c10::DeviceType::PrivateUse1);
+    } catch (const std::exception&) {
+        return false;
+    }
+    auto hccl_backend = c10::dynamic_intrusive_pointer_cast<ProcessGroupHCCL>(backend);
+    double alpha_us = 0;
+    double beta_us_per_byte = 0;
+    if (!hccl_backend ||
+        !hccl_backend->fitCollectiveLatency(c10d::OpType::ALLREDUCE, alpha_us, beta_us_per_byte)) {
+        return false;
+    }
+    alpha_ns = alpha_us * 1000;
+    beta_ns_per_byte = beta_us_per_byte * 1000;
+    return true;
+}
+
+double get_cvar_double(const std::string& name, double default_value) {
+    auto value = c10d::getCvarString({name}, "N/A");
+    if (value == "N/A") {
+        return default_value;
+    }
+    try {
+        auto parsed = std::stod(value);
+        if (parsed > 0) {
+            return parsed;
+        }
+    } catch (const std::exception&) {
+    }
+    TORCH_WARN_ONCE("Ignoring invalid value ", value, " of ", name, ", using ", default_value, " instead.");
+    return default_value;
+}
+
+// Fills the estimated collective and completion times of the plan, whose bucket
+// sizes and ready times must already be set. Collectives run one at a time.
+void estimate_bucket_plan(BucketPlan& plan) {
+    plan.comm_time_ns.clear();
+    plan.end_time_ns.clear();
+    int64_t comm_free_ns = 0;
+    for (const auto i : c10::irange(plan.bucket_bytes.size())) {
+        auto comm_ns = static_cast<int64_t>(plan.alpha_ns + plan.beta_ns_per_byte * plan.bucket_bytes[i]);
+        comm_free_ns = std::max(comm_free_ns, plan.ready_time_ns[i]) + comm_ns;
+        plan.comm_time_ns.push_back(comm_ns);
+        plan.end_time_ns.push_back(comm_free_ns);
+    }
+}
+
 // Macro that wraps TORCH_CHECK with DDP logging.
 #define REDUCER_CHECK(cond, logger_, ...)             \
     if (C10_UNLIKELY_OR_CONST(!(cond))) {               \
@@ -1653,13 +1710,49 @@ bool Reducer::rebuild_buckets() {
         std::reverse(rebuilt_params_.begin(), rebuilt_params_.end());
         std::reverse(rebuilt_param_indices_.begin(), rebuilt_param_indices_.end());
     }
-    std::tie(rebuilt_bucket_indices, per_bucket_size_limits) =
-        c10d_npu::compute_bucket_assignment_by_size(
+    // Opt-in: choose bucket boundaries from the gradient ready times measured in
+    // the first iteration instead of purely by byte caps.
+    auto ddp_overlap_aware_buckets = !ddp_set_last_bucket_as_small &&
+        (c10d::getCvarString({"DDP_OVERLAP_AWARE_BUCKETS"}, "N/A").compare("1") == 0);
+    bool overlap_planned = false;
+    if (ddp_overlap_aware_buckets) {
+        std::vector<int64_t> ready_time_ns;
+        ready_time_ns.reserve(rebuilt_param_indices_.size());
+        for (const auto index : rebuilt_param_indices_) {
+            ready_time_ns.push_back(backward_stats_[index]);
+        }
+        double alpha_ns = 0;
+        double beta_ns_per_byte = 0;
+        bool cost_from_stats = fit_allreduce_cost(process_group_, alpha_ns, beta_ns_per_byte);
+        if (!cost_from_stats) {
+            alpha_ns = get_cvar_double("DDP_BUCKET_PLAN_ALPHA_US", kDefaultBucketPlanAlphaUs) * 1000;
+            beta_ns_per_byte = 1.0 / get_cvar_double("DDP_BUCKET_PLAN_BANDWIDTH_GBPS", kDefaultBucketPlanBandwidthGBps);
+        }
+        auto plan = c10d_npu::compute_bucket_assignment_by_overlap(
             rebuilt_params_,
-            bucket_size_limits,
-            expect_sparse_gradients_,
+            ready_time_ns,
             rebuilt_param_indices_,
-            logger_);
+            static_cast<size_t>(bucket_bytes_cap_),
+            alpha_ns,
+            beta_ns_per_byte,
+            expect_sparse_gradients_);
+        plan.cost_from_stats = cost_from_stats;
+        if (!plan.bucket_indices.empty()) {
+            rebuilt_bucket_indices = plan.bucket_indices;
+            per_bucket_size_limits.assign(rebuilt_bucket_indices.size(), static_cast<size_t>(bucket_bytes_cap_));
+            bucket_plan_ = std::move(plan);
+            overlap_planned = true;
+        }
+    }
+    if (!overlap_planned) {
+        std::tie(rebuilt_bucket_indices, per_bucket_size_limits) =
+            c10d_npu::compute_bucket_assignment_by_size(
+                rebuilt_params_,
+                bucket_size_limits,
+                expect_sparse_gradients_,
+                rebuilt_param_indices_,
+                logger_);
+    }
 
     if (ddp_set_last_bucket_as_small) {
         // Reverse again because buckets were rebuilt in the opposite of gradient
@@ -1682,6 +1775,29 @@ bool Reducer::rebuild_buckets() {
     // After syncing up rebuilt bucket indices, initialize buckets for reducer.
     sync_bucket_indices(rebuilt_bucket_indices);
 
+    if (overlap_planned) {
+        // Rank 0's buckets are used everywhere, estimate them with the local timings.
+        bucket_plan_.bucket_indices = rebuilt_bucket_indices;
+        bucket_plan_.bucket_bytes.clear();
+        bucket_plan_.ready_time_ns.clear();
+        for (const auto& bucket : rebuilt_bucket_indices) {
+            size_t bytes = 0;
+            int64_t ready_ns = 0;
+            for (const auto index : bucket) {
+                bytes += static_cast<size_t>(physical_numel(params_[index]) * params_[index].element_size());
+                ready_ns = std::max(ready_ns, backward_stats_[index]);
+            }
+            bucket_plan_.bucket_bytes.push_back(bytes);
+            bucket_plan_.ready_time_ns.push_back(ready_ns);
+        }
+        estimate_bucket_plan(bucket_plan_);
+        if (ddp_debug_level_ != c10d::DebugLevel::Off) {
+            LOG(INFO) << rebuilt_bucket_indices.size()
+                    << " buckets planned for overlap, estimated communication end "
+                    << bucket_plan_.end_time_ns.back() << " ns after backward start.";
+        }
+    }
+
     has_rebuilt_bucket_ = true;
     rebuilt_params_.clear();
     rebuilt_param_indices_.clear();
@@ -1725,6 +1841,32 @@ void Reducer::register_builtin_comm_hook(c10d::BuiltinCommHookType comm_hook_typ
     }
 }
 
+// See Note [DDP Communication Hook]
+void Reducer::register_builtin_comm_hook(c10d_npu::BuiltinCommHookType comm_hook_type) {
+    REDUCER_CHECK(
+        comm_hook_ == nullptr,
+        logger_,
+        "register_builtin_comm_hook or register_comm_hook can only be called once.",
+        DIST_ERROR(ErrCode::PTR));
+
+    switch (comm_hook_type) {
+        case c10d_npu::BuiltinCommHookType::BF16_COMPRESS:
+            comm_hook_ = std::make_unique<c10d_npu::BF16CompressCommHook>(process_group_);
+            LOG(INFO) << "Built-in communication hook BF16_COMPRESS is registered.";
+            break;
+        case c10d_npu::BuiltinCommHookType::BLOCKWISE_INT8_COMPRESS:
+            comm_hook_ = std::make_unique<c10d_npu::BlockwiseInt8CompressCommHook>(process_group_, false);
+            LOG(INFO) << "Built-in communication hook BLOCKWISE_INT8_COMPRESS is registered.";
+            break;
+        case c10d_npu::BuiltinCommHookType::BLOCKWISE_INT8_COMPRESS_WITH_ERROR_FEEDBACK:
+            comm_hook_ = std::make_unique<c10d_npu::BlockwiseInt8CompressCommHook>(process_group_, true);
+            LOG(INFO) << "Built-in communication hook BLOCKWISE_INT8_COMPRESS_WITH_ERROR_FEEDBACK is registered.";
+            break;
+        default:
+            TORCH_WARN_ONCE("Unknown built-in DDP comm hook type is provided. No comm hook will be used.");
+    }
+}
+
 void Reducer::ensure_prior_reduction_finished() {
     // Check that any prior reduction has finished.
     // The variable `require_finalize_` is true until all gradients
@@ -2031,6 +2173,90 @@ std::tuple<std::vector<std::vector<size_t>>, std::vector<size_t>> compute_bucket
     return std::make_tuple(bucket_indices, per_bucket_size_limits);
 }
 
+BucketPlan compute_bucket_assignment_by_overlap(
+    const std::vector<at::Tensor>& tensors,
+    const std::vector<int64_t>& ready_time_ns,
+    const std::vector<int64_t>& tensor_indices,
+    size_t bucket_size_limit,
+    double alpha_ns,
+    double beta_ns_per_byte,
+    const std::vector<bool>& expect_sparse_gradient) {
+    TORCH_INTERNAL_ASSERT(tensors.size() == ready_time_ns.size() &&
+                              (tensor_indices.empty() || tensor_indices.size() == tensors.size()),
+                          DIST_ERROR(ErrCode::PARAM));
+    const size_t n = tensors.size();
+    if (n == 0) {
+        return BucketPlan();
+    }
+
+    std::vector<size_t> bytes(n);
+    std::vector<int64_t> ready(n);
+    int64_t latest_ready_ns = 0;
+    for (const auto i : c10::irange(n)) {
+        const auto& tensor = tensors[i];
+        const size_t tensor_index = tensor_indices.empty() ? i : static_cast<size_t>(tensor_indices[i]);
+        if (tensor.is_sparse() ||
+            (!expect_sparse_gradient.empty() && expect_sparse_gradient[tensor_index]) ||
+            tensor.scalar_type() != tensors[0].scalar_type() ||
+            tensor.device() != tensors[0].device()) {
+            return BucketPlan();
+        }
+        // The planner is pure bookkeeping, so host tensors are accepted as well.
+        const int64_t numel = tensor.device().type() == c10::DeviceType::PrivateUse1 ?
+            physical_numel(tensor) : tensor.numel();
+        bytes[i] = static_cast<size_t>(numel * tensor.element_size());
+        // A bucket is launched once all of its gradients are ready.
+        latest_ready_ns = std::max(latest_ready_ns, ready_time_ns[i]);
+        ready[i] = latest_ready_ns;
+    }
+
+    // end[j] is the earliest completion of the collectives covering the first j
+    // tensors. Finishing a collective later never lets the next one finish sooner,
+    // so extending the best plans of the prefixes yields the best plan overall.
+    std::vector<double> end(n + 1, 0);
+    std::vector<size_t> start(n + 1, 0);
+    for (size_t j = 1; j <= n; ++j) {
+        end[j] = std::numeric_limits<double>::infinity();
+        size_t bucket_bytes = 0;
+        for (size_t i = j; i-- > 0;) {
+            bucket_bytes += bytes[i];
+            if (i + 1 < j && bucket_bytes > bucket_size_limit) {
+                break;
+            }
+            double candidate = std::max(end[i], static_cast<double>(ready[j - 1])) +
+                alpha_ns + beta_ns_per_byte * bucket_bytes;
+            // Prefer fewer, larger buckets on ties.
+            if (candidate <= end[j]) {
+                end[j] = candidate;
+                start[j] = i;
+            }
+        }
+    }
+
+    std::vector<std::pair<size_t, size_t>> ranges;
+    for (size_t j = n; j > 0; j = start[j]) {
+        ranges.emplace_back(start[j], j);
+    }
+    std::reverse(ranges.begin(), ranges.end());
+
+    BucketPlan plan;
+    plan.alpha_ns = alpha_ns;
+    plan.beta_ns_per_byte = beta_ns_per_byte;
+    for (const auto& range : ranges) {
+        std::vector<size_t> indices;
+        size_t bucket_bytes = 0;
+        for (size_t i = range.first; i < range.second; ++i) {
+            indices.push_back(tensor_indices.empty() ? i : static_cast<size_t>(tensor_indices[i]));
+            bucket_bytes += bytes[i];
+        }
+        plan.bucket_indices.push_back(std::move(indices));
+        plan.bucket_bytes.push_back(bucket_bytes);
+        plan.ready_time_ns.push_back(ready[range.second - 1]);
+    }
+    estimate_bucket_plan(plan);
+    return plan;
+}
+
 // Verifies corresponding params in the model replica have the same sizes/strides
 // across processes.
 void verify_params_across_processes(
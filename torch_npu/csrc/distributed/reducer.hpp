@@ -25,6 +25,8 @@
 #include <c10d/logger.hpp>
 #include <c10d/debug.h>
 
+#include "torch_npu/csrc/distributed/default_comm_hooks.hpp"
+
 namespace c10d_npu {
 
 constexpr int kDefaultFirstBucketBytes = int(1024 * 1024);
@@ -38,6 +40,31 @@ inline int64_t current_time_in_nanos()
     return c10::getTime();
 }
 
+// Default alpha-beta cost of one collective used by the overlap-aware bucket
+// planner when the process group has no collective statistics to fit it to,
+// overridable with DDP_BUCKET_PLAN_ALPHA_US / DDP_BUCKET_PLAN_BANDWIDTH_GBPS.
+constexpr double kDefaultBucketPlanAlphaUs = 30.0;
+constexpr double kDefaultBucketPlanBandwidthGBps = 20.0;
+
+// Bucket assignment chosen by compute_bucket_assignment_by_overlap, together with
+// the cost model estimates it was based on. Times are relative to the start of
+// the backward pass, like get_backward_stats().
+struct BucketPlan {
+    std::vector<std::vector<size_t>> bucket_indices;
+    std::vector<size_t> bucket_bytes;
+    // Time the last gradient of each bucket became ready.
+    std::vector<int64_t> ready_time_ns;
+    // Estimated time each bucket's collective takes: alpha + beta * bytes.
+    std::vector<int64_t> comm_time_ns;
+    // Estimated completion time of each bucket's collective.
+    std::vector<int64_t> end_time_ns;
+    double alpha_ns = 0;
+    double beta_ns_per_byte = 0;
+    // Whether alpha and beta were fitted to the allreduce latencies the process
+    // group recorded, rather than taken from the defaults.
+    bool cost_from_stats = false;
+};
+
 // Forward declaration
 class Logger;
 
@@ -157,6 +184,12 @@ public:
         return backward_stats_;
     }
 
+    // Returns the bucket plan of the last rebuild when DDP_OVERLAP_AWARE_BUCKETS=1,
+    // empty otherwise.
+    BucketPlan get_bucket_plan() const {
+        return bucket_plan_;
+    }
+
     // Registers a hook to the reducer. The hook is `CommHookInterface`
     // type to allow both Python and CPP hooks. This function can only
     // be called once before calling backward.
@@ -168,6 +201,9 @@ public:
     // Cannot combine with the call of `register_comm_hook`.
     void register_builtin_comm_hook(c10d::BuiltinCommHookType comm_hook_type);
 
+    // Same as above for the built-in hooks only provided by torch_npu.
+    void register_builtin_comm_hook(c10d_npu::BuiltinCommHookType comm_hook_type);
+
     // Runs allreduce or installed communication hook given GradBucket instance.
     c10::intrusive_ptr<c10::ivalue::Future> run_comm_hook(
         c10d::GradBucket& grad_bucket);
@@ -482,6 +518,9 @@ protected:
     // the point in time buckets were ready, or ideal bucket assignment/ordering.
     std::vector<int64_t> backward_stats_;
 
+    // Result of the overlap-aware planner at the last bucket rebuild.
+    BucketPlan bucket_plan_;
+
     bool should_collect_runtime_stats();
     void record_forward_compute_start_time();
     void record_backward_compute_start_time();
@@ -610,6 +649,21 @@ std::tuple<std::vector<std::vector<size_t>>, std::vector<size_t>> compute_bucket
     const std::vector<int64_t>& tensor_indices = {},
     const c10::optional<std::weak_ptr<c10d::Logger>>& logger = {});
 
+// Chooses bucket boundaries over dense tensors given in gradient-ready order, so
+// that the last collective finishes as early as possible. Each collective is
+// modelled as alpha + beta * bytes, launched once its last gradient is ready and
+// run one at a time on the communication stream. Buckets never exceed
+// bucket_size_limit unless a single tensor does. Returns an empty plan when the
+// tensors cannot share buckets freely (sparse gradients, mixed dtypes or devices).
+BucketPlan compute_bucket_assignment_by_overlap(
+    const std::vector<at::Tensor>& tensors,
+    const std::vector<int64_t>& ready_time_ns,
+    const std::vector<int64_t>& tensor_indices,
+    size_t bucket_size_limit,
+    double alpha_ns,
+    double beta_ns_per_byte,
+    const std::vector<bool>& expect_sparse_gradient = {});
+
 // Verify models across all processes are the same as model on rank 0 with
 // respect to no. of params and matching dtype/size/layout.
 void verify_params_across_processes(
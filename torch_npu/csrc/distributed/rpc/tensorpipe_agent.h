@@ -75,6 +75,7 @@ constexpr int64_t kBasicChannelPriority = 1000;
 // CPU channel have higher priority than NPU channels, since the latter might
 // handle CPU-to-CPU transfers, but will always be less efficient than their
 // CPU-only counterparts.
+constexpr int64_t kNpuPipelinedChannelPriority = 100;
 constexpr int64_t kNpuBasicChannelPriority = 0;
 
 using steady_clock_time_point = std::chrono::time_point<std::chrono::steady_clock>;
@@ -1,16 +1,27 @@
 #ifdef USE_RPC_FRAMEWORK
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <iostream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 
+#include <tensorpipe/channel/channel.h>
+#include <tensorpipe/channel/context.h>
 #include <tensorpipe/tensorpipe.h>
 #include <tensorpipe/tensorpipe_npu.h>
 #include <torch_npu/csrc/distributed/rpc/tensorpipe_agent.h>
 #include <torch_npu/csrc/distributed/rpc/tensorpipe_utils.h>
 
 #include "torch_npu/csrc/core/NPUStorageImpl.h"
+#include "torch_npu/csrc/core/npu/CachingHostAllocator.h"
 #include "torch_npu/csrc/core/npu/NPUCachingAllocator.h"
+#include "torch_npu/csrc/core/npu/NPUFunctions.h"
 #include "torch_npu/csrc/core/npu/NPUStream.h"
 #include "torch_npu/csrc/core/npu/SecondaryStreamGuard.h"
+#include "torch_npu/csrc/core/npu/interface/AclInterface.h"
 
 namespace torch_npu {
 namespace distributed {
@@ -26,6 +37,710 @@ std::unique_ptr<ChannelRegistration> makeNpuBasicChannel()
 
 C10_REGISTER_CREATOR(TensorPipeChannelRegistry, npu_basic, makeNpuBasicChannel);
 
+// Pipelined NPU channel. npu_basic stages a whole tensor to host before handing
+// it to the CPU channel, so D2H copy, wire transfer and H2D copy are serialized.
+// This channel instead streams the tensor in chunks through a small ring of
+// pinned host buffers, so the copy of one chunk overlaps the transfer of others.
+
+const std::string kNpuPipelineChunkBytesEnvVar = "TP_NPU_PIPELINE_CHUNK_BYTES";
+const std::string kNpuPipelineDepthEnvVar = "TP_NPU_PIPELINE_DEPTH";
+constexpr size_t kDefaultNpuPipelineChunkBytes = 1024 * 1024;
+constexpr size_t kDefaultNpuPipelineDepth = 4;
+
+size_t getPositiveSizeFromEnv(const std::string &name, size_t defaultValue)
+{
+    char *value = std::getenv(name.c_str());
+    if (value == nullptr) {
+        return defaultValue;
+    }
+    try {
+        auto parsed = std::stoll(value);
+        if (parsed > 0) {
+            return static_cast<size_t>(parsed);
+        }
+    } catch (const std::exception &) {
+    }
+    LOG(WARNING) << "Ignoring invalid value " << value << " of " << name << ", defaulting to " << defaultValue;
+    return defaultValue;
+}
+
+class NpuPipelineError final : public tensorpipe_npu::BaseError {
+public:
+    explicit NpuPipelineError(std::string what) : what_(std::move(what)) {}
+
+    std::string what() const override
+    {
+        return what_;
+    }
+
+private:
+    std::string what_;
+};
+
+tensorpipe_npu::Error makeAclError(const char *call, aclError ret)
+{
+    return tensorpipe_npu::Error(
+        std::make_shared<NpuPipelineError>(std::string(call) + " failed with ACL error " + std::to_string(ret)),
+        __FILE__, __LINE__);
+}
+
+// Single thread on which all the state of the pipelined channels is touched, like
+// the TensorPipe loops. Tasks are queued per channel and run in order within their
+// queue. A task may be bound to an event on a stream, in which case it, and every
+// task queued after it, only runs once the NPU work queued before the event has
+// completed. A second thread blocks on those events in the order they were
+// recorded and wakes the loop as each one completes, so neither thread spins
+// while copies are in flight and the loop keeps serving the channels of other
+// pipes in the meantime.
+class NpuPipelineLoop {
+public:
+    // Receives the error of the event the task was bound to, if any.
+    using Callback = std::function<void(const tensorpipe_npu::Error &)>;
+
+    NpuPipelineLoop() : thread_([this]() { run(); }), eventThread_([this]() { waitEvents(); }) {}
+
+    ~NpuPipelineLoop()
+    {
+        join();
+    }
+
+    void defer(const void *queue, std::function<void()> fn)
+    {
+        enqueue(queue, Task{nullptr, [fn = std::move(fn)](const tensorpipe_npu::Error &) { fn(); }});
+    }
+
+    // Must be called from the loop, after enqueuing NPU work on the stream.
+    void deferAfter(const void *queue, int device, aclrtStream stream, Callback fn)
+    {
+        aclrtEvent event = nullptr;
+        auto flags = c10_npu::acl::IsExistCreateEventExWithFlag() ? ACL_EVENT_SYNC : ACL_EVENT_DEFAULT;
+        aclError ret = c10_npu::acl::AclrtCreateEventWithFlag(&event, flags);
+        if (ret == ACL_ERROR_NONE) {
+            ret = aclrtRecordEvent(event, stream);
+            if (ret != ACL_ERROR_NONE) {
+                aclrtDestroyEvent(event);
+            }
+        }
+        if (ret != ACL_ERROR_NONE) {
+            auto error = makeAclError("aclrtRecordEvent", ret);
+            enqueue(queue, Task{nullptr, [fn = std::move(fn), error](const tensorpipe_npu::Error &) { fn(error); }});
+            return;
+        }
+        auto wait = std::make_shared<EventWait>();
+        wait->device = device;
+        wait->event = event;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            events_.push_back(wait);
+        }
+        eventCv_.notify_one();
+        enqueue(queue, Task{std::move(wait), std::move(fn)});
+    }
+
+    // Stops the loop once all queued tasks have run. The context joins the loop
+    // before it drops its reference, so the last reference is never released by a
+    // task running on the loop and this is never called from the loop itself.
+    void join()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+        }
+        cv_.notify_one();
+        if (thread_.joinable()) {
+            TORCH_INTERNAL_ASSERT(thread_.get_id() != std::this_thread::get_id(),
+                                  "NpuPipelineLoop cannot be joined from its own thread");
+            thread_.join();
+        }
+        // The loop only returns once every event it waited for has completed.
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            eventsClosed_ = true;
+        }
+        eventCv_.notify_one();
+        if (eventThread_.joinable()) {
+            eventThread_.join();
+        }
+    }
+
+private:
+    struct EventWait {
+        int device = -1;
+        aclrtEvent event = nullptr;
+        // Written by the event thread before `done' is set.
+        aclError ret = ACL_ERROR_NONE;
+        std::atomic<bool> done{false};
+    };
+
+    struct Task {
+        std::shared_ptr<EventWait> wait;
+        Callback fn;
+    };
+
+    void enqueue(const void *queue, Task task)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            incoming_.emplace_back(queue, std::move(task));
+        }
+        cv_.notify_one();
+    }
+
+    // Events are waited for one at a time in recording order. The copies behind
+    // them are short and bounded by the pipeline depth, so a slow event only
+    // delays the notification of the ones recorded after it.
+    void waitEvents()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            eventCv_.wait(lock, [this]() { return eventsClosed_ || !events_.empty(); });
+            if (events_.empty()) {
+                return;
+            }
+            auto wait = std::move(events_.front());
+            events_.pop_front();
+            lock.unlock();
+            aclError ret = c10_npu::SetDevice(static_cast<c10::DeviceIndex>(wait->device));
+            if (ret == ACL_ERROR_NONE) {
+                ret = aclrtSynchronizeEvent(wait->event);
+            }
+            wait->ret = ret;
+            wait->done.store(true, std::memory_order_release);
+            lock.lock();
+            eventCompleted_ = true;
+            cv_.notify_one();
+        }
+    }
+
+    // Runs the tasks at the front of one queue up to the first whose event is
+    // still pending. A failed event is passed to its task instead of thrown here.
+    static void drain(std::deque<Task> &tasks)
+    {
+        while (!tasks.empty()) {
+            auto error = tensorpipe_npu::Error::kSuccess;
+            Task &front = tasks.front();
+            if (front.wait != nullptr) {
+                if (!front.wait->done.load(std::memory_order_acquire)) {
+                    return;
+                }
+                if (front.wait->ret != ACL_ERROR_NONE) {
+                    error = makeAclError("Wait for an NPU copy event", front.wait->ret);
+                }
+                aclrtDestroyEvent(front.wait->event);
+            }
+            Task task = std::move(front);
+            tasks.pop_front();
+            try {
+                task.fn(error);
+            } catch (const std::exception &e) {
+                LOG(ERROR) << "Unexpected error in the npu_pipelined channel loop: " << e.what();
+            }
+        }
+    }
+
+    void run()
+    {
+        // Both only touched by the loop thread.
+        std::unordered_map<const void *, std::deque<Task>> queues;
+        std::vector<std::pair<const void *, Task>> incoming;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                // Tasks left in the queues all wait for an event, so once closed the
+                // loop keeps sleeping until those events complete.
+                cv_.wait(lock, [this, &queues]() {
+                    return eventCompleted_ || !incoming_.empty() || (closed_ && queues.empty());
+                });
+                if (closed_ && incoming_.empty() && queues.empty()) {
+                    return;
+                }
+                eventCompleted_ = false;
+                incoming.swap(incoming_);
+            }
+            for (auto &entry : incoming) {
+                queues[entry.first].push_back(std::move(entry.second));
+            }
+            incoming.clear();
+            for (auto it = queues.begin(); it != queues.end();) {
+                drain(it->second);
+                it = it->second.empty() ? queues.erase(it) : std::next(it);
+            }
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<std::pair<const void *, Task>> incoming_;
+    bool closed_ = false;
+    bool eventCompleted_ = false;
+    std::condition_variable eventCv_;
+    std::deque<std::shared_ptr<EventWait>> events_;
+    bool eventsClosed_ = false;
+    std::thread thread_;
+    std::thread eventThread_;
+};
+
+class NpuPipelinedChannel : public tensorpipe_npu::channel::Channel,
+                            public std::enable_shared_from_this<NpuPipelinedChannel> {
+public:
+    NpuPipelinedChannel(std::shared_ptr<tensorpipe_npu::channel::Channel> cpuChannel,
+                        std::shared_ptr<NpuPipelineLoop> loop, size_t chunkBytes, size_t depth)
+        : cpuChannel_(std::move(cpuChannel)), loop_(std::move(loop)), chunkBytes_(chunkBytes), depth_(depth)
+    {
+    }
+
+    void send(tensorpipe_npu::Buffer buffer, size_t length, tensorpipe_npu::channel::TSendCallback callback) override
+    {
+        auto op = makeOp(buffer, length, std::move(callback));
+        if (op->onNpu) {
+            op->chunkBytes = chunkBytes_;
+            op->numChunks = length / chunkBytes_ + (length % chunkBytes_ != 0 ? 1 : 0);
+        }
+        loop_->defer(this, [self = shared_from_this(), op]() {
+            self->sendOps_.push_back(op);
+            self->advanceSends();
+        });
+    }
+
+    void recv(tensorpipe_npu::Buffer buffer, size_t length, tensorpipe_npu::channel::TRecvCallback callback) override
+    {
+        auto op = makeOp(buffer, length, std::move(callback));
+        loop_->defer(this, [self = shared_from_this(), op]() {
+            self->recvOps_.push_back(op);
+            self->advanceRecvs();
+        });
+    }
+
+    void setId(std::string id) override
+    {
+        cpuChannel_->setId(std::move(id));
+    }
+
+    // Pending ops complete with the errors reported by the CPU channel.
+    void close() override
+    {
+        cpuChannel_->close();
+    }
+
+private:
+    // Sent ahead of the chunks of every non-empty NPU op, so that the receiver
+    // splits the tensor the way the sender did whatever its own settings are.
+    struct ChunkHeader {
+        uint64_t chunkBytes = 0;
+        uint64_t numChunks = 0;
+    };
+
+    struct Op {
+        tensorpipe_npu::Buffer buffer;
+        bool onNpu = false;
+        char *ptr = nullptr;
+        aclrtStream stream = nullptr;
+        int device = -1;
+        size_t length = 0;
+        ChunkHeader header;
+        // Known upfront on the sender, taken from the header on the receiver.
+        size_t chunkBytes = 0;
+        size_t numChunks = 0;
+        // Chunks plus the header, 0 until the header is sent or received.
+        size_t numParts = 0;
+        bool headerRequested = false;
+        // Chunks whose copy (send) or receive (recv) has been started.
+        size_t nextChunk = 0;
+        size_t doneParts = 0;
+        tensorpipe_npu::Error error = tensorpipe_npu::Error::kSuccess;
+        std::function<void(const tensorpipe_npu::Error &)> callback;
+    };
+
+    static std::shared_ptr<Op> makeOp(tensorpipe_npu::Buffer buffer, size_t length,
+                                      std::function<void(const tensorpipe_npu::Error &)> callback)
+    {
+        auto op = std::make_shared<Op>();
+        op->buffer = buffer;
+        op->length = length;
+        op->callback = std::move(callback);
+        if (buffer.device().type == tensorpipe_npu::kNpuDeviceType) {
+            auto npuBuffer = buffer.unwrap<tensorpipe_npu::NPUBuffer>();
+            op->onNpu = true;
+            op->ptr = static_cast<char *>(npuBuffer.ptr);
+            op->stream = npuBuffer.stream;
+            op->device = buffer.device().index;
+        }
+        return op;
+    }
+
+    static size_t chunkLength(const Op &op, size_t chunk)
+    {
+        return std::min(op.chunkBytes, op.length - chunk * op.chunkBytes);
+    }
+
+    tensorpipe_npu::Error allocateSlots(std::vector<at::DataPtr> &slots, std::deque<size_t> &freeSlots,
+                                        size_t slotBytes, int device)
+    {
+        if (!slots.empty()) {
+            return tensorpipe_npu::Error::kSuccess;
+        }
+        aclError ret = c10_npu::SetDevice(static_cast<c10::DeviceIndex>(device));
+        if (ret != ACL_ERROR_NONE) {
+            return makeAclError("aclrtSetDevice", ret);
+        }
+        for (size_t i = 0; i < depth_; ++i) {
+            slots.push_back(at_npu::native::getCachingHostAllocator()->allocate(slotBytes));
+            freeSlots.push_back(i);
+        }
+        return tensorpipe_npu::Error::kSuccess;
+    }
+
+    // Accounts for `parts' parts of the op, the callback fires with the first
+    // error once all of them are accounted for.
+    void completeParts(Op &op, size_t parts, const tensorpipe_npu::Error &error)
+    {
+        if (error && !op.error) {
+            op.error = error;
+        }
+        op.doneParts += parts;
+        if (op.numParts != 0 && op.doneParts == op.numParts) {
+            op.callback(op.error);
+        }
+    }
+
+    // Gives up on the chunks of the op that have not been started, and on
+    // `extraParts' more. The CPU channel matches messages by order, so the peers
+    // are out of step from here on. Closing it fails the pending and later ops on
+    // both sides instead of leaving the peer waiting for chunks that never come.
+    void abandonChunks(Op &op, size_t extraParts, const tensorpipe_npu::Error &error)
+    {
+        size_t remaining = op.numChunks - op.nextChunk + extraParts;
+        op.nextChunk = op.numChunks;
+        cpuChannel_->close();
+        completeParts(op, remaining, error);
+    }
+
+    // The CPU channel matches sends and receives by order, so an op only starts
+    // once every chunk of the previous op has been handed to it.
+    void advanceSends()
+    {
+        while (!sendOps_.empty()) {
+            auto op = sendOps_.front();
+            if (!op->onNpu || op->numChunks == 0) {
+                sendOps_.pop_front();
+                // Deferred so that it queues behind the chunks still waiting for their copies.
+                loop_->defer(this, [self = shared_from_this(), op]() { self->forwardSend(op); });
+                continue;
+            }
+            if (op->numParts == 0) {
+                op->numParts = op->numChunks + 1;
+                auto error = allocateSlots(sendSlots_, freeSendSlots_, chunkBytes_, op->device);
+                if (error) {
+                    // The header has not been sent either.
+                    abandonChunks(*op, 1, error);
+                } else {
+                    // Deferred like forwardSend, ahead of the chunks of this op.
+                    loop_->defer(this, [self = shared_from_this(), op]() { self->sendHeader(op); });
+                }
+            }
+            while (op->nextChunk < op->numChunks && !freeSendSlots_.empty()) {
+                size_t slot = freeSendSlots_.front();
+                size_t chunk = op->nextChunk;
+                size_t length = chunkLength(*op, chunk);
+                aclError ret = c10_npu::SetDevice(static_cast<c10::DeviceIndex>(op->device));
+                if (ret == ACL_ERROR_NONE) {
+                    ret = aclrtMemcpyAsync(sendSlots_[slot].get(), length, op->ptr + chunk * op->chunkBytes, length,
+                                           ACL_MEMCPY_DEVICE_TO_HOST, op->stream);
+                }
+                if (ret != ACL_ERROR_NONE) {
+                    abandonChunks(*op, 0, makeAclError("aclrtMemcpyAsync", ret));
+                    break;
+                }
+                freeSendSlots_.pop_front();
+                op->nextChunk++;
+                loop_->deferAfter(this, op->device, op->stream,
+                                  [self = shared_from_this(), op, slot, length](const tensorpipe_npu::Error &error) {
+                                      self->postSendChunk(op, slot, length, error);
+                                  });
+            }
+            if (op->nextChunk < op->numChunks) {
+                return;
+            }
+            sendOps_.pop_front();
+        }
+    }
+
+    void sendHeader(const std::shared_ptr<Op> &op)
+    {
+        op->header.chunkBytes = op->chunkBytes;
+        op->header.numChunks = op->numChunks;
+        tensorpipe_npu::CpuBuffer buffer;
+        buffer.ptr = &op->header;
+        cpuChannel_->send(buffer, sizeof(ChunkHeader),
+                          [self = shared_from_this(), op](const tensorpipe_npu::Error &error) {
+                              self->loop_->defer(self.get(),
+                                                 [self, op, error]() { self->completeParts(*op, 1, error); });
+                          });
+    }
+
+    void forwardSend(const std::shared_ptr<Op> &op)
+    {
+        if (op->onNpu) {
+            loop_->defer(this, [op]() { op->callback(tensorpipe_npu::Error::kSuccess); });
+            return;
+        }
+        cpuChannel_->send(op->buffer, op->length, [self = shared_from_this(), op](const tensorpipe_npu::Error &error) {
+            self->loop_->defer(self.get(), [op, error]() { op->callback(error); });
+        });
+    }
+
+    void postSendChunk(const std::shared_ptr<Op> &op, size_t slot, size_t length,
+                       const tensorpipe_npu::Error &copyError)
+    {
+        if (copyError) {
+            // The receiver still expects this chunk.
+            freeSendSlots_.push_back(slot);
+            cpuChannel_->close();
+            completeParts(*op, 1, copyError);
+            advanceSends();
+            return;
+        }
+        tensorpipe_npu::CpuBuffer buffer;
+        buffer.ptr = sendSlots_[slot].get();
+        cpuChannel_->send(buffer, length, [self = shared_from_this(), op, slot](const tensorpipe_npu::Error &error) {
+            self->loop_->defer(self.get(), [self, op, slot, error]() {
+                self->freeSendSlots_.push_back(slot);
+                self->completeParts(*op, 1, error);
+                self->advanceSends();
+            });
+        });
+    }
+
+    void advanceRecvs()
+    {
+        while (!recvOps_.empty()) {
+            auto op = recvOps_.front();
+            if (!op->onNpu || op->length == 0) {
+                recvOps_.pop_front();
+                forwardRecv(op);
+                continue;
+            }
+            if (!op->headerRequested) {
+                op->headerRequested = true;
+                tensorpipe_npu::CpuBuffer buffer;
+                buffer.ptr = &op->header;
+                cpuChannel_->recv(buffer, sizeof(ChunkHeader),
+                                  [self = shared_from_this(), op](const tensorpipe_npu::Error &error) {
+                                      self->loop_->defer(self.get(),
+                                                         [self, op, error]() { self->onRecvHeader(op, error); });
+                                  });
+            }
+            if (op->numParts == 0) {
+                return;
+            }
+            if (op->nextChunk < op->numChunks && recvSlotBytes_ != op->chunkBytes) {
+                // The sender changed its chunk size, resize the slots once they are all back.
+                if (freeRecvSlots_.size() != recvSlots_.size()) {
+                    return;
+                }
+                recvSlots_.clear();
+                freeRecvSlots_.clear();
+                recvSlotBytes_ = op->chunkBytes;
+                auto error = allocateSlots(recvSlots_, freeRecvSlots_, recvSlotBytes_, op->device);
+                if (error) {
+                    recvSlotBytes_ = 0;
+                    abandonChunks(*op, 0, error);
+                }
+            }
+            while (op->nextChunk < op->numChunks && !freeRecvSlots_.empty()) {
+                size_t slot = freeRecvSlots_.front();
+                freeRecvSlots_.pop_front();
+                size_t chunk = op->nextChunk++;
+                tensorpipe_npu::CpuBuffer buffer;
+                buffer.ptr = recvSlots_[slot].get();
+                cpuChannel_->recv(buffer, chunkLength(*op, chunk),
+                                  [self = shared_from_this(), op, slot, chunk](const tensorpipe_npu::Error &error) {
+                                      self->loop_->defer(self.get(), [self, op, slot, chunk, error]() {
+                                          self->onRecvChunk(op, slot, chunk, error);
+                                      });
+                                  });
+            }
+            if (op->nextChunk < op->numChunks) {
+                return;
+            }
+            recvOps_.pop_front();
+        }
+    }
+
+    void onRecvHeader(const std::shared_ptr<Op> &op, const tensorpipe_npu::Error &error)
+    {
+        auto headerError = error;
+        const ChunkHeader &header = op->header;
+        if (!headerError && (header.chunkBytes == 0 ||
+                             header.numChunks != op->length / header.chunkBytes +
+                                                     (op->length % header.chunkBytes != 0 ? 1 : 0))) {
+            headerError = tensorpipe_npu::Error(
+                std::make_shared<NpuPipelineError>(
+                    "npu_pipelined received " + std::to_string(header.numChunks) + " chunks of " +
+                    std::to_string(header.chunkBytes) + " bytes for a tensor of " + std::to_string(op->length) +
+                    " bytes"),
+                __FILE__, __LINE__);
+            cpuChannel_->close();
+        }
+        if (!headerError) {
+            op->chunkBytes = header.chunkBytes;
+            op->numChunks = header.numChunks;
+        }
+        op->numParts = op->numChunks + 1;
+        completeParts(*op, 1, headerError);
+        advanceRecvs();
+    }
+
+    void forwardRecv(const std::shared_ptr<Op> &op)
+    {
+        if (op->onNpu) {
+            loop_->defer(this, [op]() { op->callback(tensorpipe_npu::Error::kSuccess); });
+            return;
+        }
+        cpuChannel_->recv(op->buffer, op->length, [self = shared_from_this(), op](const tensorpipe_npu::Error &error) {
+            self->loop_->defer(self.get(), [op, error]() { op->callback(error); });
+        });
+    }
+
+    void onRecvChunk(const std::shared_ptr<Op> &op, size_t slot, size_t chunk, const tensorpipe_npu::Error &error)
+    {
+        auto chunkError = error;
+        if (!chunkError) {
+            size_t length = chunkLength(*op, chunk);
+            aclError ret = c10_npu::SetDevice(static_cast<c10::DeviceIndex>(op->device));
+            if (ret == ACL_ERROR_NONE) {
+                ret = aclrtMemcpyAsync(op->ptr + chunk * op->chunkBytes, length, recvSlots_[slot].get(), length,
+                                       ACL_MEMCPY_HOST_TO_DEVICE, op->stream);
+            }
+            if (ret != ACL_ERROR_NONE) {
+                chunkError = makeAclError("aclrtMemcpyAsync", ret);
+            }
+        }
+        if (chunkError) {
+            freeRecvSlots_.push_back(slot);
+        } else {
+            // The slot can only be refilled once the copy out of it has completed.
+            // The op has already completed by then, so an event error only shows up
+            // on the device, as it does for npu_basic.
+            loop_->deferAfter(this, op->device, op->stream,
+                              [self = shared_from_this(), slot](const tensorpipe_npu::Error &) {
+                                  self->freeRecvSlots_.push_back(slot);
+                                  self->advanceRecvs();
+                              });
+        }
+        // Like npu_basic, completion means the data is enqueued on the stream.
+        completeParts(*op, 1, chunkError);
+        if (chunkError) {
+            advanceRecvs();
+        }
+    }
+
+    std::shared_ptr<tensorpipe_npu::channel::Channel> cpuChannel_;
+    std::shared_ptr<NpuPipelineLoop> loop_;
+    // Local settings of the sending side. Receives follow the sender's header.
+    const size_t chunkBytes_;
+    const size_t depth_;
+
+    std::deque<std::shared_ptr<Op>> sendOps_;
+    std::deque<std::shared_ptr<Op>> recvOps_;
+    std::vector<at::DataPtr> sendSlots_;
+    std::vector<at::DataPtr> recvSlots_;
+    size_t recvSlotBytes_ = 0;
+    std::deque<size_t> freeSendSlots_;
+    std::deque<size_t> freeRecvSlots_;
+};
+
+// Uses a CPU channel for the wire and npu_basic only to describe the devices, so
+// that both peers agree on which NPU pairs the channel can serve.
+class NpuPipelinedContext : public tensorpipe_npu::channel::Context {
+public:
+    NpuPipelinedContext(std::shared_ptr<tensorpipe_npu::channel::Context> cpuContext,
+                        std::shared_ptr<tensorpipe_npu::channel::Context> npuBasicContext, size_t chunkBytes,
+                        size_t depth)
+        : cpuContext_(std::move(cpuContext)), npuBasicContext_(std::move(npuBasicContext)),
+          loop_(std::make_shared<NpuPipelineLoop>()), chunkBytes_(chunkBytes), depth_(depth)
+    {
+    }
+
+    bool isViable() const override
+    {
+        return cpuContext_->isViable() && npuBasicContext_->isViable();
+    }
+
+    size_t numConnectionsNeeded() const override
+    {
+        return cpuContext_->numConnectionsNeeded();
+    }
+
+    const std::unordered_map<tensorpipe_npu::Device, std::string> &deviceDescriptors() const override
+    {
+        return npuBasicContext_->deviceDescriptors();
+    }
+
+    bool canCommunicateWithRemote(const std::string &localDeviceDescriptor,
+                                  const std::string &remoteDeviceDescriptor) const override
+    {
+        return npuBasicContext_->canCommunicateWithRemote(localDeviceDescriptor, remoteDeviceDescriptor);
+    }
+
+    std::shared_ptr<tensorpipe_npu::channel::Channel> createChannel(
+        std::vector<std::shared_ptr<tensorpipe_npu::transport::Connection>> connections,
+        tensorpipe_npu::Endpoint endpoint) override
+    {
+        return std::make_shared<NpuPipelinedChannel>(cpuContext_->createChannel(std::move(connections), endpoint),
+                                                     loop_, chunkBytes_, depth_);
+    }
+
+    void setId(std::string id) override
+    {
+        cpuContext_->setId(id + ".cpu");
+        npuBasicContext_->setId(id + ".npu_basic");
+    }
+
+    void close() override
+    {
+        cpuContext_->close();
+        npuBasicContext_->close();
+    }
+
+    void join() override
+    {
+        cpuContext_->join();
+        npuBasicContext_->join();
+        loop_->join();
+    }
+
+    // Channels keep the loop alive, and a channel may be released by a task on the
+    // loop. Joining here makes sure the context's reference, the one that outlives
+    // the tasks, is never the last one dropped on the loop thread.
+    ~NpuPipelinedContext() override
+    {
+        join();
+    }
+
+private:
+    std::shared_ptr<tensorpipe_npu::channel::Context> cpuContext_;
+    std::shared_ptr<tensorpipe_npu::channel::Context> npuBasicContext_;
+    std::shared_ptr<NpuPipelineLoop> loop_;
+    const size_t chunkBytes_;
+    const size_t depth_;
+};
+
+std::unique_ptr<ChannelRegistration> makeNpuPipelinedChannel()
+{
+    auto context = std::make_shared<NpuPipelinedContext>(
+        tensorpipe_npu::channel::basic::create(),
+        tensorpipe_npu::channel::npu_basic::create(tensorpipe_npu::channel::basic::create()),
+        getPositiveSizeFromEnv(kNpuPipelineChunkBytesEnvVar, kDefaultNpuPipelineChunkBytes),
+        getPositiveSizeFromEnv(kNpuPipelineDepthEnvVar, kDefaultNpuPipelineDepth));
+    return std::make_unique<ChannelRegistration>(ChannelRegistration{std::move(context), kNpuPipelinedChannelPriority});
+}
+
+// Preferred over npu_basic for NPU tensors. The chunk size and the number of
+// pinned chunks in flight per direction are set with TP_NPU_PIPELINE_CHUNK_BYTES
+// and TP_NPU_PIPELINE_DEPTH.
+C10_REGISTER_CREATOR(TensorPipeChannelRegistry, npu_pipelined, makeNpuPipelinedChannel);
+
 // Tensor Send/Recv Preparation
 class TensorpipeNpuConverter : public TensorpipeDeviceTypeConverter {
 public:
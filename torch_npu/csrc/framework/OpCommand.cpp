@@ -4,6 +4,7 @@
 #include "torch_npu/csrc/framework/OpCommand.h"
 #include "torch_npu/csrc/core/npu/register/OptionsManager.h"
 #include "torch_npu/csrc/framework/OpCmdHelper.h"
+#include "torch_npu/csrc/framework/OpHostStats.h"
 #include "torch_npu/csrc/core/npu/NPUException.h"
 #include "torch_npu/csrc/core/npu/CachingHostAllocator.h"
 #include "torch_npu/csrc/core/npu/interface/AsyncTaskQueueInterface.h"
@@ -40,6 +41,9 @@ OpCommand::OpCommand()
     aclCmds = OpCommandImpls::GetInstance();
     aclCmds->Push(aclCmd);
     aclCmd->SetCustomHandler(nullptr);
+    if (C10_UNLIKELY(OpHostStats::GetInstance().IsEnabled())) {
+        build_start_ns_ = OpHostStats::NowNs();
+    }
 }
 
 OpCommand& OpCommand::Name(const string &name) {
@@ -146,6 +150,11 @@ void OpCommand::Run() {
         ExecuteParas execParams;
         aclCmd->ExportParams(execParams);
         c10_npu::queue::QueueParas params(c10_npu::queue::COMPILE_AND_EXECUTE, sizeof(ExecuteParas), &execParams);
+        if (C10_UNLIKELY(build_start_ns_ != 0)) {
+            params.enqueue_time_ns = OpHostStats::NowNs();
+            OpHostStats::GetInstance().Record(op_name.c_str(), OpHostPhase::BUILD,
+                                              params.enqueue_time_ns - build_start_ns_);
+        }
         c10_npu::enCurrentNPUStream(&params);
 #ifndef BUILD_LIBTORCH
         at_npu::native::NpuUtils::ProfReportMarkDataToNpuProfiler(1, op_name, params.correlation_id);
@@ -157,7 +166,14 @@ void OpCommand::Run() {
             trigger->traceNpuAclStartExecution(op_name);
         }
 #endif
-        aclCmd->Run(sync, sync_index, outputTensor);
+        if (C10_UNLIKELY(build_start_ns_ != 0)) {
+            OpHostStats::GetInstance().Record(op_name.c_str(), OpHostPhase::BUILD,
+                                              OpHostStats::NowNs() - build_start_ns_);
+        }
+        {
+            OpHostLaunchGuard hostStatsGuard(op_name.c_str());
+            aclCmd->Run(sync, sync_index, outputTensor);
+        }
         if (c10_npu::option::OptionsManager::CheckBlockingEnable()) {
             Sync();
         }
@@ -176,6 +192,7 @@ void OpCommand::RunOpApi(const string &op_name, PROC_FUNC func, bool sync)
 #ifndef BUILD_LIBTORCH
     const c10_npu::impl::PyCallbackTrigger* trigger = c10_npu::impl::NPUTrace::getTrace();
 #endif
+    const uint64_t build_start_ns = C10_UNLIKELY(OpHostStats::GetInstance().IsEnabled()) ? OpHostStats::NowNs() : 0;
     auto stream = c10_npu::getCurrentNPUStream();
     if (!stream.isSyncLaunchStream() && c10_npu::option::OptionsManager::GetTaskQueueEnable()) {
         RECORD_FUNCTION(op_name, std::vector<c10::IValue>({}));
@@ -191,6 +208,11 @@ void OpCommand::RunOpApi(const string &op_name, PROC_FUNC func, bool sync)
         execParams.customHandler = func;
 
         c10_npu::queue::QueueParas params(c10_npu::queue::EXECUTE_OPAPI, sizeof(ExecuteParasOpApi), &execParams);
+        if (C10_UNLIKELY(build_start_ns != 0)) {
+            params.enqueue_time_ns = OpHostStats::NowNs();
+            OpHostStats::GetInstance().Record(op_name.c_str(), OpHostPhase::BUILD,
+                                              params.enqueue_time_ns - build_start_ns);
+        }
         c10_npu::enCurrentNPUStream(&params);
 #ifndef BUILD_LIBTORCH
         at_npu::native::NpuUtils::ProfReportMarkDataToNpuProfiler(1, op_name, params.correlation_id);
@@ -201,7 +223,14 @@ void OpCommand::RunOpApi(const string &op_name, PROC_FUNC func, bool sync)
             trigger->traceNpuAclStartExecution(op_name);
         }
 #endif
-        OpCommandImpl::RunOpApi(op_name, func);
+        if (C10_UNLIKELY(build_start_ns != 0)) {
+            OpHostStats::GetInstance().Record(op_name.c_str(), OpHostPhase::BUILD,
+                                              OpHostStats::NowNs() - build_start_ns);
+        }
+        {
+            OpHostLaunchGuard hostStatsGuard(op_name.c_str());
+            OpCommandImpl::RunOpApi(op_name, func);
+        }
         if (c10_npu::option::OptionsManager::CheckBlockingEnable()) {
             NPU_CHECK_ERROR(c10_npu::acl::AclrtSynchronizeStreamWithTimeout(stream));
         }
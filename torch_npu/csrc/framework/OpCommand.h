@@ -170,6 +170,7 @@ private:
     c10::SmallVector<int64_t, N> sync_index;
     c10::SmallVector<at::Tensor, N> outputTensor;
     c10::SmallVector<at::Tensor, N> inputTensor;
+    uint64_t build_start_ns_ = 0; // set only when op host stats are enabled
 }; // class OpCommand
 } // namespace native
 } // namespace at_npu
@@ -0,0 +1,186 @@
+#include <chrono>
+
+#include "torch_npu/csrc/core/npu/NPUFunctions.h"
+#include "torch_npu/csrc/core/npu/npu_log.h"
+#include "torch_npu/csrc/core/npu/interface/AclInterface.h"
+#include "torch_npu/csrc/core/npu/register/OptionsManager.h"
+#include "torch_npu/csrc/core/npu/sys_ctrl/npu_sys_ctrl.h"
+#include "torch_npu/csrc/framework/OpHostStats.h"
+#include "torch_npu/csrc/framework/OpDeviceTimer.h"
+
+namespace at_npu {
+namespace native {
+
+OpDeviceTimer& OpDeviceTimer::GetInstance()
+{
+    static OpDeviceTimer instance;
+    return instance;
+}
+
+OpDeviceTimer::OpDeviceTimer()
+{
+    uint32_t interval = c10_npu::option::OptionsManager::GetOpDeviceTimingInterval();
+    if (interval != 0) {
+        SetInterval(interval);
+    }
+}
+
+OpDeviceTimer::~OpDeviceTimer()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    if (collector_.joinable()) {
+        collector_.join();
+    }
+    // The events are left to the runtime, which may already be finalized.
+}
+
+void OpDeviceTimer::SetInterval(uint32_t interval)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (interval != 0 && !collector_.joinable()) {
+        collector_ = std::thread(&OpDeviceTimer::CollectLoop, this);
+    }
+    interval_.store(interval, std::memory_order_relaxed);
+}
+
+OpDeviceTimer::EventPair *OpDeviceTimer::Begin(const char *opName, aclrtStream stream)
+{
+    // One counter per consumer thread, that is per device.
+    static thread_local uint32_t launches = 0;
+    uint32_t interval = interval_.load(std::memory_order_relaxed);
+    if (interval == 0 || launches++ % interval != 0 || !OpHostStats::GetInstance().IsEnabled()) {
+        return nullptr;
+    }
+    int32_t device = 0;
+    if (c10_npu::GetDevice(&device) != ACL_ERROR_NONE) {
+        return nullptr;
+    }
+    EventPair *pair = AcquirePair(device);
+    if (pair == nullptr) {
+        return nullptr;
+    }
+    if (aclrtRecordEvent(pair->start, stream) != ACL_ERROR_NONE) {
+        ReleasePair(pair);
+        return nullptr;
+    }
+    pair->opName = opName;
+    return pair;
+}
+
+void OpDeviceTimer::End(EventPair *pair, aclrtStream stream)
+{
+    if (aclrtRecordEvent(pair->end, stream) != ACL_ERROR_NONE) {
+        ReleasePair(pair);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_.push_back(pair);
+}
+
+void OpDeviceTimer::Cancel(EventPair *pair)
+{
+    ReleasePair(pair);
+}
+
+OpDeviceTimer::EventPair *OpDeviceTimer::AcquirePair(int32_t device)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto &free_pairs = free_pairs_[device];
+    if (!free_pairs.empty()) {
+        EventPair *pair = free_pairs.back();
+        free_pairs.pop_back();
+        return pair;
+    }
+    size_t &created = created_pairs_[device];
+    if (created >= kMaxPairsPerDevice) {
+        return nullptr;
+    }
+    auto pair = std::make_unique<EventPair>();
+    pair->device = device;
+    if (c10_npu::acl::AclrtCreateEventWithFlag(&pair->start, ACL_EVENT_TIME_LINE) != ACL_ERROR_NONE) {
+        ASCEND_LOGW("OpDeviceTimer failed to create an event on device %d.", device);
+        return nullptr;
+    }
+    if (c10_npu::acl::AclrtCreateEventWithFlag(&pair->end, ACL_EVENT_TIME_LINE) != ACL_ERROR_NONE) {
+        ASCEND_LOGW("OpDeviceTimer failed to create an event on device %d.", device);
+        aclrtDestroyEvent(pair->start);
+        return nullptr;
+    }
+    created++;
+    pairs_.push_back(std::move(pair));
+    return pairs_.back().get();
+}
+
+void OpDeviceTimer::ReleasePair(EventPair *pair)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_pairs_[pair->device].push_back(pair);
+}
+
+bool OpDeviceTimer::Resolve(EventPair *pair)
+{
+    if (c10_npu::acl::IsExistQueryEventRecordedStatus()) {
+        c10_npu::acl::aclrtEventRecordedStatus status = c10_npu::acl::ACL_EVENT_RECORDED_STATUS_NOT_READY;
+        if (c10_npu::acl::AclQueryEventRecordedStatus(pair->end, &status) != ACL_ERROR_NONE) {
+            return true;
+        }
+        if (status != c10_npu::acl::ACL_EVENT_RECORDED_STATUS_COMPLETE) {
+            return false;
+        }
+    } else if (aclrtSynchronizeEvent(pair->end) != ACL_ERROR_NONE) {
+        return true;
+    }
+    float elapsed_ms = 0;
+    if (aclrtEventElapsedTime(&elapsed_ms, pair->start, pair->end) == ACL_ERROR_NONE && elapsed_ms >= 0) {
+        OpHostStats::GetInstance().Record(pair->opName.c_str(), OpHostPhase::DEVICE,
+                                          static_cast<uint64_t>(static_cast<double>(elapsed_ms) * 1000000));
+    }
+    return true;
+}
+
+void OpDeviceTimer::CollectLoop()
+{
+    int32_t current_device = -1;
+    std::vector<EventPair *> pending;
+    std::vector<EventPair *> waiting;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_) {
+        cv_.wait_for(lock, std::chrono::milliseconds(kCollectPeriodMs), [this] { return stop_; });
+        if (stop_ || pending_.empty() || !c10_npu::NpuSysCtrl::GetInstance().GetInitFlag()) {
+            continue;
+        }
+        pending.swap(pending_);
+        lock.unlock();
+        std::vector<EventPair *> resolved;
+        for (EventPair *pair : pending) {
+            if (pair->device != current_device) {
+                if (c10_npu::SetDevice(pair->device) != ACL_ERROR_NONE) {
+                    waiting.push_back(pair);
+                    continue;
+                }
+                current_device = pair->device;
+            }
+            if (Resolve(pair)) {
+                resolved.push_back(pair);
+            } else {
+                waiting.push_back(pair);
+            }
+        }
+        pending.clear();
+        lock.lock();
+        for (EventPair *pair : resolved) {
+            free_pairs_[pair->device].push_back(pair);
+        }
+        // Pairs submitted meanwhile go after the ones still waiting.
+        waiting.insert(waiting.end(), pending_.begin(), pending_.end());
+        pending_.swap(waiting);
+        waiting.clear();
+    }
+}
+
+} // namespace native
+} // namespace at_npu
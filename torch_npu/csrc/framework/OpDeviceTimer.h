@@ -0,0 +1,126 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <c10/macros/Macros.h>
+
+#include "third_party/acl/inc/acl/acl_rt.h"
+#include "torch_npu/csrc/core/npu/NPUMacros.h"
+
+namespace at_npu {
+namespace native {
+
+// Device execution time of task queue operators. The queue consumer thread
+// records a pair of timeline events around every Nth launch; a collector
+// thread resolves the completed pairs into the DEVICE phase of OpHostStats and
+// hands the events back to a per device pool. Launches sampled while all
+// kMaxPairsPerDevice pairs of their device are in flight stay untimed, so the
+// cost is bounded however far the device lags behind.
+class TORCH_NPU_API OpDeviceTimer {
+public:
+    struct EventPair {
+        aclrtEvent start = nullptr;
+        aclrtEvent end = nullptr;
+        int32_t device = 0;
+        std::string opName;
+    };
+
+    static constexpr size_t kMaxPairsPerDevice = 256;
+    static constexpr int kCollectPeriodMs = 2;
+
+    static OpDeviceTimer& GetInstance();
+    ~OpDeviceTimer();
+
+    bool IsEnabled() const
+    {
+        return interval_.load(std::memory_order_relaxed) != 0;
+    }
+
+    uint32_t GetInterval() const
+    {
+        return interval_.load(std::memory_order_relaxed);
+    }
+
+    // Times every interval-th launch of each consumer thread, 0 stops timing.
+    void SetInterval(uint32_t interval);
+
+    // Called by OpDeviceTimerGuard on the consumer thread. Begin returns
+    // nullptr for launches that are not timed, Cancel gives back the pair of
+    // a launch that failed without recording its end.
+    EventPair *Begin(const char *opName, aclrtStream stream);
+    void End(EventPair *pair, aclrtStream stream);
+    void Cancel(EventPair *pair);
+
+private:
+    OpDeviceTimer();
+    EventPair *AcquirePair(int32_t device);
+    void ReleasePair(EventPair *pair);
+    bool Resolve(EventPair *pair);
+    void CollectLoop();
+
+    std::atomic<uint32_t> interval_{0};
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stop_ = false;
+    std::thread collector_;
+    std::vector<EventPair *> pending_;
+    std::unordered_map<int32_t, std::vector<EventPair *>> free_pairs_;
+    std::unordered_map<int32_t, size_t> created_pairs_;
+    std::vector<std::unique_ptr<EventPair>> pairs_;
+};
+
+// Records the events of a sampled launch. Start goes right before the launch
+// call so host side preparation stays out of the device time, Finish records
+// the end only when the launch succeeded. A started pair that is not finished
+// is cancelled on scope exit.
+class OpDeviceTimerGuard {
+public:
+    OpDeviceTimerGuard(const char *opName, aclrtStream stream) : opName_(opName), stream_(stream) {}
+
+    void Start()
+    {
+        if (C10_LIKELY(!OpDeviceTimer::GetInstance().IsEnabled())) {
+            return;
+        }
+        pair_ = OpDeviceTimer::GetInstance().Begin(opName_, stream_);
+    }
+
+    void Finish(aclError ret)
+    {
+        if (C10_LIKELY(pair_ == nullptr)) {
+            return;
+        }
+        if (ret == ACL_ERROR_NONE) {
+            OpDeviceTimer::GetInstance().End(pair_, stream_);
+        } else {
+            OpDeviceTimer::GetInstance().Cancel(pair_);
+        }
+        pair_ = nullptr;
+    }
+
+    ~OpDeviceTimerGuard()
+    {
+        if (C10_UNLIKELY(pair_ != nullptr)) {
+            OpDeviceTimer::GetInstance().Cancel(pair_);
+        }
+    }
+
+    OpDeviceTimerGuard(const OpDeviceTimerGuard &) = delete;
+    OpDeviceTimerGuard &operator=(const OpDeviceTimerGuard &) = delete;
+
+private:
+    const char *opName_;
+    aclrtStream stream_;
+    OpDeviceTimer::EventPair *pair_ = nullptr;
+};
+
+} // namespace native
+} // namespace at_npu
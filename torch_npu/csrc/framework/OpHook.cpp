@@ -1,8 +1,31 @@
+#include <chrono>
+#include <thread>
+
 #include "torch_npu/csrc/framework/OpHook.h"
+#include "torch_npu/csrc/core/npu/NPUException.h"
 
 namespace at_npu {
 namespace native {
 
+namespace {
+// Sampling decisions of the open PreHook calls of a thread, one per nesting
+// level, so that every PostHook matches its PreHook.
+thread_local std::vector<bool> sampled_stack;
+thread_local uint64_t sample_calls = 0;
+
+uint64_t NextRandom()
+{
+    // xorshift64*, seeded per thread
+    thread_local uint64_t state =
+        (std::hash<std::thread::id>()(std::this_thread::get_id()) ^
+         static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count())) | 1;
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return state * 0x2545F4914F6CDD1DULL;
+}
+} // namespace
+
 OpHook& OpHook::GetInstance()
 {
     static OpHook instance;
@@ -31,6 +54,99 @@ void OpHook::RegisterPostFn(PostFn fn)
     this->post_fn_ = fn;
 }
 
+void OpHook::SetOpList(const std::string& list)
+{
+    std::unordered_set<std::string> op_names;
+    size_t start = 0;
+    while (start <= list.size()) {
+        size_t end = list.find(',', start);
+        if (end == std::string::npos) {
+            end = list.size();
+        }
+        std::string token = list.substr(start, end - start);
+        if (!token.empty()) {
+            op_names.insert(std::move(token));
+        }
+        start = end + 1;
+    }
+    UpdateSampleConfig([&op_names](OpHookSampleConfig& config) { config.op_names = std::move(op_names); });
+}
+
+void OpHook::SetSampleInterval(uint64_t interval)
+{
+    TORCH_CHECK(interval >= 1, "OP_HOOK_SAMPLE_INTERVAL should be at least 1, but got ", interval,
+                PTA_ERROR(ErrCode::VALUE));
+    UpdateSampleConfig([interval](OpHookSampleConfig& config) { config.interval = interval; });
+}
+
+void OpHook::SetSampleRate(double rate)
+{
+    TORCH_CHECK(rate > 0 && rate <= 1, "OP_HOOK_SAMPLE_RATE should be in (0, 1], but got ", rate,
+                PTA_ERROR(ErrCode::VALUE));
+    // 2^64 * rate, rate 1 hooks every call without drawing a random number.
+    uint64_t threshold = rate < 1 ? static_cast<uint64_t>(rate * 18446744073709551616.0) : UINT64_MAX;
+    UpdateSampleConfig([threshold](OpHookSampleConfig& config) { config.rate_threshold = threshold; });
+}
+
+void OpHook::UpdateSampleConfig(const std::function<void(OpHookSampleConfig&)>& update)
+{
+    std::lock_guard<std::mutex> lock(sample_config_mutex_);
+    update(pending_config_);
+    if (pending_config_.op_names.empty() && pending_config_.interval == 1 &&
+        pending_config_.rate_threshold == UINT64_MAX) {
+        sample_config_.store(nullptr, std::memory_order_release);
+        return;
+    }
+    sample_configs_.push_back(std::make_unique<OpHookSampleConfig>(pending_config_));
+    sample_config_.store(sample_configs_.back().get(), std::memory_order_release);
+}
+
+bool OpHook::Sample(const std::string& op_name)
+{
+    const OpHookSampleConfig* config = sample_config_.load(std::memory_order_acquire);
+    if (config == nullptr) {
+        return true;
+    }
+    if (!config->op_names.empty() && config->op_names.find(op_name) == config->op_names.end()) {
+        return false;
+    }
+    if (config->interval > 1 && sample_calls++ % config->interval != 0) {
+        return false;
+    }
+    return config->rate_threshold == UINT64_MAX || NextRandom() < config->rate_threshold;
+}
+
+bool OpHook::PushSampled(const std::string& op_name)
+{
+    bool sampled = Sample(op_name);
+    sampled_stack.push_back(sampled);
+    return sampled;
+}
+
+bool OpHook::PopSampled()
+{
+    if (sampled_stack.empty()) {
+        // PostHook without a PreHook on this thread. Only hooked when nothing
+        // is filtered out.
+        return sample_config_.load(std::memory_order_acquire) == nullptr;
+    }
+    bool sampled = sampled_stack.back();
+    sampled_stack.pop_back();
+    return sampled;
+}
+
+size_t OpHook::SampledDepth() const
+{
+    return sampled_stack.size();
+}
+
+void OpHook::UnwindSampled(size_t depth)
+{
+    if (sampled_stack.size() > depth) {
+        sampled_stack.resize(depth);
+    }
+}
+
 void OpHook::HookBegin(std::string& op_name)
 {
     if (this->begin_fn_ != nullptr) {
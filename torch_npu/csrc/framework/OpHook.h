@@ -3,10 +3,16 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <tuple>
 #include <vector>
 #include <string>
 #include <iostream>
+#include <unordered_set>
 
 #include <ATen/ATen.h>
 #include <ATen/Tensor.h>
@@ -20,6 +26,17 @@ using EndFn = void (*)();
 using PreFn = void (*)(const at::Tensor& at_tensor);
 using PostFn = void (*)(const at::Tensor& at_tensor);
 
+// Which hook calls reach the registered functions, set through the
+// OP_HOOK_OP_LIST, OP_HOOK_SAMPLE_INTERVAL and OP_HOOK_SAMPLE_RATE options.
+struct OpHookSampleConfig {
+    // Empty hooks every op.
+    std::unordered_set<std::string> op_names;
+    // Hooks every Nth call of the selected ops on each thread.
+    uint64_t interval = 1;
+    // Hooks a call if a random 64-bit value is below it, UINT64_MAX hooks all.
+    uint64_t rate_threshold = UINT64_MAX;
+};
+
 class OpHook {
 public:
     static OpHook& GetInstance();
@@ -30,6 +47,10 @@ public:
     void RegisterPreFn(PreFn fn);
     void RegisterPostFn(PostFn fn);
 
+    void SetOpList(const std::string& list);
+    void SetSampleInterval(uint64_t interval);
+    void SetSampleRate(double rate);
+
     void HookBegin(std::string& op_name);
     void HookEnd();
 
@@ -67,9 +88,15 @@ public:
         return (HookArg(args), ...);
     }
 
+    // Calls that are not sampled return after the sampling decision, their
+    // PostHook pops that decision again, see PushSampled. For ops that run
+    // both halves on the calling thread, see OpHookStackGuard.
     template <typename... Ts>
     void PreHook(std::string op_name, Ts&... args)
     {
+        if (!PushSampled(op_name)) {
+            return;
+        }
         this->is_in_pre_hook_ = true;
         HookBegin(op_name);
         HookArgs(args...);
@@ -78,19 +105,80 @@ public:
     template <typename... Ts>
     void PostHook(Ts&... args)
     {
+        if (!PopSampled()) {
+            return;
+        }
+        this->is_in_pre_hook_ = false;
+        HookArgs(args...);
+        HookEnd();
+    }
+
+    // Collectives run their PostHook when the work is waited on, in any order
+    // and possibly on another thread. The caller keeps the returned sampling
+    // decision with the work and passes it back to CollectivePostHook.
+    template <typename... Ts>
+    bool CollectivePreHook(std::string op_name, Ts&... args)
+    {
+        if (!Sample(op_name)) {
+            return false;
+        }
+        this->is_in_pre_hook_ = true;
+        HookBegin(op_name);
+        HookArgs(args...);
+        return true;
+    }
+
+    template <typename... Ts>
+    void CollectivePostHook(bool sampled, Ts&... args)
+    {
+        if (!sampled) {
+            return;
+        }
         this->is_in_pre_hook_ = false;
         HookArgs(args...);
         HookEnd();
     }
 
+    size_t SampledDepth() const;
+    void UnwindSampled(size_t depth);
+
 private:
     OpHook();
 
+    bool Sample(const std::string& op_name);
+    bool PushSampled(const std::string& op_name);
+    bool PopSampled();
+    void UpdateSampleConfig(const std::function<void(OpHookSampleConfig&)>& update);
+
     BeginFn begin_fn_ = nullptr;
     EndFn end_fn_ = nullptr;
     PreFn pre_fn_ = nullptr;
     PostFn post_fn_ = nullptr;
     bool is_in_pre_hook_ = true;
+
+    // Null while every call is hooked. Replaced configs are kept alive, hooks
+    // on other threads may still read them.
+    std::atomic<const OpHookSampleConfig*> sample_config_{nullptr};
+    OpHookSampleConfig pending_config_;
+    std::vector<std::unique_ptr<OpHookSampleConfig>> sample_configs_;
+    std::mutex sample_config_mutex_;
+};
+
+// Drops the sampling decisions a hooked op left on the stack of its thread
+// when it threw between its PreHook and PostHook.
+class OpHookStackGuard {
+public:
+    OpHookStackGuard() : depth_(OpHook::GetInstance().SampledDepth()) {}
+    ~OpHookStackGuard()
+    {
+        OpHook::GetInstance().UnwindSampled(depth_);
+    }
+
+    OpHookStackGuard(const OpHookStackGuard&) = delete;
+    OpHookStackGuard& operator=(const OpHookStackGuard&) = delete;
+
+private:
+    size_t depth_;
 };
 
 TORCH_NPU_API void RegisterOpHookBeginFn(BeginFn fn);
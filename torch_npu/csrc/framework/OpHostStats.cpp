@@ -0,0 +1,181 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "torch_npu/csrc/core/npu/register/OptionsManager.h"
+#include "torch_npu/csrc/framework/OpHostStats.h"
+
+namespace at_npu {
+namespace native {
+
+namespace {
+
+constexpr char kOthersName[] = "others";
+
+constexpr int Log2(int value)
+{
+    return value <= 1 ? 0 : 1 + Log2(value / 2);
+}
+
+// Bits below the leading one that select the bucket within an octave.
+constexpr int kStepBits = Log2(OpHostStats::kBucketsPerOctave);
+static_assert((1 << kStepBits) == OpHostStats::kBucketsPerOctave, "kBucketsPerOctave must be a power of two");
+static_assert(kStepBits <= OpHostStats::kMinOctave, "kBucketsPerOctave is too fine for kMinOctave");
+
+uint64_t HashName(const char *name)
+{
+    // FNV-1a, never 0 so that 0 can mark a free slot.
+    uint64_t hash = 14695981039346656037ULL;
+    for (; *name != '\0'; ++name) {
+        hash = (hash ^ static_cast<uint8_t>(*name)) * 1099511628211ULL;
+    }
+    return hash | 1;
+}
+
+double BucketMiddleNs(int bucket)
+{
+    if (bucket == 0) {
+        return std::exp2(OpHostStats::kMinOctave) / 2;
+    }
+    int octave = OpHostStats::kMinOctave + bucket / OpHostStats::kBucketsPerOctave;
+    int step = bucket % OpHostStats::kBucketsPerOctave;
+    return std::exp2(octave) * (1.0 + (step + 0.5) / OpHostStats::kBucketsPerOctave);
+}
+
+} // namespace
+
+OpHostStats& OpHostStats::GetInstance()
+{
+    static OpHostStats instance;
+    return instance;
+}
+
+OpHostStats::OpHostStats()
+{
+    if (c10_npu::option::OptionsManager::CheckOpHostStatsEnable()) {
+        SetEnabled(true);
+    }
+}
+
+void OpHostStats::SetEnabled(bool enabled)
+{
+    if (enabled) {
+        std::lock_guard<std::mutex> lock(init_mutex_);
+        if (entries_ == nullptr) {
+            // One extra slot collects the operators that do not fit in the table.
+            entries_.reset(new Entry[kMaxOps + 1]);
+            strncpy(entries_[kMaxOps].name, kOthersName, kMaxNameLen - 1);
+            entries_[kMaxOps].ready.store(true, std::memory_order_release);
+        }
+    }
+    // Release pairs with the acquire in IsEnabled, recorders see the table.
+    enabled_.store(enabled, std::memory_order_release);
+}
+
+int OpHostStats::LatencyBucket(uint64_t durationNs)
+{
+    if (durationNs < (1ULL << kMinOctave)) {
+        return 0;
+    }
+    int octave = 63 - __builtin_clzll(durationNs);
+    int step = static_cast<int>((durationNs >> (octave - kStepBits)) & (kBucketsPerOctave - 1));
+    return std::min((octave - kMinOctave) * kBucketsPerOctave + step, kLatencyBuckets - 1);
+}
+
+OpHostStats::Entry &OpHostStats::GetEntry(const char *opName)
+{
+    uint64_t hash = HashName(opName);
+    uint32_t slot = static_cast<uint32_t>(hash) & (kMaxOps - 1);
+    for (uint32_t probe = 0; probe < kMaxOps; ++probe, slot = (slot + 1) & (kMaxOps - 1)) {
+        Entry &entry = entries_[slot];
+        uint64_t current = entry.hash.load(std::memory_order_acquire);
+        if (current == 0 && entry.hash.compare_exchange_strong(current, hash, std::memory_order_acq_rel)) {
+            strncpy(entry.name, opName, kMaxNameLen - 1);
+            entry.ready.store(true, std::memory_order_release);
+            return entry;
+        }
+        if (current == hash) {
+            // The claiming thread is copying the name, which takes a few ns.
+            while (!entry.ready.load(std::memory_order_acquire)) {
+            }
+            return entry;
+        }
+    }
+    return entries_[kMaxOps];
+}
+
+void OpHostStats::Record(const char *opName, OpHostPhase phase, uint64_t durationNs)
+{
+    if (!IsEnabled() || opName == nullptr) {
+        return;
+    }
+    PhaseStats &stats = GetEntry(opName).phases[static_cast<size_t>(phase)];
+    stats.totalNs.fetch_add(durationNs, std::memory_order_relaxed);
+    stats.histogram[LatencyBucket(durationNs)].fetch_add(1, std::memory_order_relaxed);
+    uint64_t maxNs = stats.maxNs.load(std::memory_order_relaxed);
+    while (durationNs > maxNs &&
+           !stats.maxNs.compare_exchange_weak(maxNs, durationNs, std::memory_order_relaxed)) {
+    }
+}
+
+std::vector<OpHostStatsRow> OpHostStats::Snapshot(bool reset)
+{
+    std::vector<OpHostStatsRow> rows;
+    {
+        std::lock_guard<std::mutex> lock(init_mutex_);
+        if (entries_ == nullptr) {
+            return rows;
+        }
+    }
+    auto take = [reset](std::atomic<uint64_t> &value) {
+        return reset ? value.exchange(0, std::memory_order_relaxed) : value.load(std::memory_order_relaxed);
+    };
+    for (uint32_t slot = 0; slot <= kMaxOps; ++slot) {
+        Entry &entry = entries_[slot];
+        if (!entry.ready.load(std::memory_order_acquire)) {
+            continue;
+        }
+        OpHostStatsRow row;
+        row.opName = entry.name;
+        bool seen = false;
+        for (size_t phase = 0; phase < entry.phases.size(); ++phase) {
+            PhaseStats &stats = entry.phases[phase];
+            OpHostPhaseSummary &summary = row.phases[phase];
+            std::array<uint64_t, kLatencyBuckets> histogram;
+            uint64_t count = 0;
+            for (int bucket = 0; bucket < kLatencyBuckets; ++bucket) {
+                histogram[bucket] = take(stats.histogram[bucket]);
+                count += histogram[bucket];
+            }
+            summary.count = count;
+            summary.totalUs = static_cast<double>(take(stats.totalNs)) / 1000;
+            summary.maxUs = static_cast<double>(take(stats.maxNs)) / 1000;
+            if (count == 0) {
+                continue;
+            }
+            seen = true;
+            // Percentiles from the histogram counts so they agree with count.
+            const double quantiles[] = {0.5, 0.9, 0.99};
+            double *targets[] = {&summary.p50Us, &summary.p90Us, &summary.p99Us};
+            for (size_t i = 0; i < 3; ++i) {
+                uint64_t rank = std::max<uint64_t>(static_cast<uint64_t>(std::ceil(quantiles[i] * count)), 1);
+                uint64_t accumulated = 0;
+                for (int bucket = 0; bucket < kLatencyBuckets; ++bucket) {
+                    accumulated += histogram[bucket];
+                    if (accumulated >= rank) {
+                        double middleUs = BucketMiddleNs(bucket) / 1000;
+                        *targets[i] = summary.maxUs > 0 ? std::min(middleUs, summary.maxUs) : middleUs;
+                        break;
+                    }
+                }
+            }
+        }
+        if (seen) {
+            rows.push_back(std::move(row));
+        }
+    }
+    return rows;
+}
+
+} // namespace native
+} // namespace at_npu
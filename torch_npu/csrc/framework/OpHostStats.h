@@ -0,0 +1,141 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <c10/macros/Macros.h>
+
+#include "torch_npu/csrc/core/npu/NPUMacros.h"
+
+namespace at_npu {
+namespace native {
+
+// Host side phases of an operator:
+//   BUILD      from OpCommand construction (RunOpApi entry for aclnn ops) until
+//              the task is enqueued or, without the task queue, launched
+//   QUEUE_WAIT from enqueue until the task queue thread starts executing it
+//   LAUNCH     the compile/launch call itself, aclopCompileAndExecute or the
+//              aclnn handler, on whichever thread runs it
+// and, for the task queue launches sampled by OpDeviceTimer,
+//   DEVICE     the device execution time between the events recorded around
+//              the launch
+enum class OpHostPhase : uint8_t {
+    BUILD = 0,
+    QUEUE_WAIT,
+    LAUNCH,
+    DEVICE,
+    COUNT,
+};
+
+struct OpHostPhaseSummary {
+    uint64_t count = 0;
+    double totalUs = 0;
+    double maxUs = 0;
+    double p50Us = 0;
+    double p90Us = 0;
+    double p99Us = 0;
+};
+
+struct OpHostStatsRow {
+    std::string opName;
+    std::array<OpHostPhaseSummary, static_cast<size_t>(OpHostPhase::COUNT)> phases;
+};
+
+// Per operator histograms of host latencies, cheap enough to keep enabled in
+// production jobs. Recording is lock free: operators live in a fixed size open
+// addressing table whose slots are claimed with a CAS on the name hash, and
+// every phase is a log histogram of relaxed atomic counters with
+// kBucketsPerOctave buckets per power of two from 64ns, so percentiles are
+// accurate to about 19%. Operators beyond kMaxOps share the "others" slot.
+class TORCH_NPU_API OpHostStats {
+public:
+    static constexpr uint32_t kMaxOps = 1024;
+    static constexpr size_t kMaxNameLen = 64;
+    static constexpr int kBucketsPerOctave = 4;
+    static constexpr int kMinOctave = 6; // 64ns
+    static constexpr int kLatencyBuckets = 26 * kBucketsPerOctave;
+
+    static OpHostStats& GetInstance();
+
+    bool IsEnabled() const
+    {
+        return enabled_.load(std::memory_order_acquire);
+    }
+
+    void SetEnabled(bool enabled);
+
+    void Record(const char *opName, OpHostPhase phase, uint64_t durationNs);
+
+    // Rows of all operators seen since the last reset. With reset, counters are
+    // cleared as they are read, so periodic callers get per interval figures;
+    // samples recorded concurrently may land in either interval.
+    std::vector<OpHostStatsRow> Snapshot(bool reset = false);
+
+    static uint64_t NowNs()
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    static int LatencyBucket(uint64_t durationNs);
+
+private:
+    struct PhaseStats {
+        std::atomic<uint64_t> totalNs{0};
+        std::atomic<uint64_t> maxNs{0};
+        std::array<std::atomic<uint64_t>, kLatencyBuckets> histogram{};
+    };
+
+    struct Entry {
+        std::atomic<uint64_t> hash{0};
+        std::atomic<bool> ready{false};
+        char name[kMaxNameLen] = {0};
+        std::array<PhaseStats, static_cast<size_t>(OpHostPhase::COUNT)> phases;
+    };
+
+    OpHostStats();
+    Entry &GetEntry(const char *opName);
+
+    std::atomic<bool> enabled_{false};
+    std::mutex init_mutex_;
+    std::unique_ptr<Entry[]> entries_;
+};
+
+// Records LAUNCH for its scope and, for a dequeued task stamped at enqueue,
+// QUEUE_WAIT up to the start of the scope.
+class OpHostLaunchGuard {
+public:
+    explicit OpHostLaunchGuard(const char *opName, uint64_t enqueueTimeNs = 0) : opName_(opName)
+    {
+        if (C10_LIKELY(!OpHostStats::GetInstance().IsEnabled())) {
+            return;
+        }
+        startNs_ = OpHostStats::NowNs();
+        if (enqueueTimeNs != 0 && startNs_ > enqueueTimeNs) {
+            OpHostStats::GetInstance().Record(opName_, OpHostPhase::QUEUE_WAIT, startNs_ - enqueueTimeNs);
+        }
+    }
+
+    ~OpHostLaunchGuard()
+    {
+        if (C10_UNLIKELY(startNs_ != 0)) {
+            OpHostStats::GetInstance().Record(opName_, OpHostPhase::LAUNCH, OpHostStats::NowNs() - startNs_);
+        }
+    }
+
+    OpHostLaunchGuard(const OpHostLaunchGuard &) = delete;
+    OpHostLaunchGuard &operator=(const OpHostLaunchGuard &) = delete;
+
+private:
+    const char *opName_;
+    uint64_t startNs_ = 0;
+};
+
+} // namespace native
+} // namespace at_npu
@@ -9,6 +9,8 @@
 #include "torch_npu/csrc/framework/utils/CalcuOpUtil.h"
 #include "torch_npu/csrc/framework/utils/NpuUtils.h"
 #include "torch_npu/csrc/framework/OpParamMaker.h"
+#include "torch_npu/csrc/framework/OpHostStats.h"
+#include "torch_npu/csrc/framework/OpDeviceTimer.h"
 #include "torch_npu/csrc/framework/OpCmdHelper.h"
 #include "torch_npu/csrc/framework/interface/HcclInterface.h"
 #include "torch_npu/csrc/distributed/HCCLUtils.hpp"
@@ -313,11 +315,14 @@ int ExecFunc(c10_npu::queue::QueueParas *in, aclrtStream stream)
 {
     auto cur_paras = static_cast<ExecuteParas *>(in->paramVal);
     ASCEND_LOGD("Op %s Run.", cur_paras->opType);
+    OpHostLaunchGuard hostStatsGuard(cur_paras->opType, in->enqueue_time_ns);
+    OpDeviceTimerGuard deviceTimerGuard(cur_paras->opType, stream);
     aclError ret;
     // open the deterministicAlgorithms config
     SetDeterministic(false);
     if (cur_paras->customHandler) {
         ASCEND_LOGD("Exec Op %s with custom handle", cur_paras->opType);
+        deviceTimerGuard.Start();
         try {
             ret = cur_paras->customHandler();
         } catch (std::exception &e) {
@@ -331,6 +336,7 @@ int ExecFunc(c10_npu::queue::QueueParas *in, aclrtStream stream)
             }
             ASCEND_LOGE("Custom hand error:%s", e.what());
         }
+        deviceTimerGuard.Finish(ret);
         if (ret != ACL_ERROR_NONE && ret != ACL_ERROR_RT_DEVICE_TASK_ABORT && ret != ACL_ERROR_RT_DEVICE_MEM_ERROR &&
             ret != ACL_ERROR_RT_HBM_MULTI_BIT_ECC_ERROR) {
             ASCEND_LOGE("Custom hand fail! name=%s, ret=0x%#x", cur_paras->opType, ret);
@@ -365,6 +371,7 @@ int ExecFunc(c10_npu::queue::QueueParas *in, aclrtStream stream)
             return ret;
         }
     }
+    deviceTimerGuard.Start();
     ret = aclopCompileAndExecute(
         cur_paras->opType,
         cur_paras->paras.input_num,
@@ -378,6 +385,7 @@ int ExecFunc(c10_npu::queue::QueueParas *in, aclrtStream stream)
         ACL_COMPILE_SYS,
         nullptr,
         stream);
+    deviceTimerGuard.Finish(ret);
     if (reset_flag) {
         NPU_CHECK_ERROR_WITHOUT_UCE(AclSetCompileopt(aclCompileOpt::ACL_OP_JIT_COMPILE, "disable"));
     }
@@ -397,6 +405,8 @@ int ExecFuncOpApi(c10_npu::queue::QueueParas *in, aclrtStream stream)
 {
     auto cur_paras = static_cast<ExecuteParasOpApi *>(in->paramVal);
     ASCEND_LOGD("Op %s Run.", cur_paras->opType);
+    OpHostLaunchGuard hostStatsGuard(cur_paras->opType, in->enqueue_time_ns);
+    OpDeviceTimerGuard deviceTimerGuard(cur_paras->opType, stream);
     aclError ret;
 
     ASCEND_LOGD("Exec Op %s with custom handle", cur_paras->opType);
@@ -406,6 +416,7 @@ int ExecFuncOpApi(c10_npu::queue::QueueParas *in, aclrtStream stream)
         return ACL_ERROR_NONE;
     }
 
+    deviceTimerGuard.Start();
     try {
         ret = cur_paras->customHandler();
     } catch (std::exception &e) {
@@ -419,6 +430,7 @@ int ExecFuncOpApi(c10_npu::queue::QueueParas *in, aclrtStream stream)
         }
         ASCEND_LOGE("Custom hand error:%s", e.what());
     }
+    deviceTimerGuard.Finish(ret);
     if (ret != ACL_ERROR_NONE && ret != ACL_ERROR_RT_DEVICE_TASK_ABORT && ret != ACL_ERROR_RT_DEVICE_MEM_ERROR &&
         ret != ACL_ERROR_RT_HBM_MULTI_BIT_ECC_ERROR) {
         ASCEND_LOGE("Custom hand fail! name=%s, ret=0x%#x", cur_paras->opType, ret);
@@ -520,6 +532,7 @@ void CopyFunc(void *dst, void *src)
     dstPtr->paramType = srcPtr->paramType;
     dstPtr->paramLen = srcPtr->paramLen;
     dstPtr->correlation_id = srcPtr->correlation_id;
+    dstPtr->enqueue_time_ns = srcPtr->enqueue_time_ns;
     if (dstPtr->paramType == c10_npu::queue::EXECUTE_OPAPI) {
         new (dstPtr->paramVal) ExecuteParasOpApi();
         (static_cast<ExecuteParasOpApi*>(dstPtr->paramVal))->Copy(*(static_cast<ExecuteParasOpApi*>(srcPtr->paramVal)));
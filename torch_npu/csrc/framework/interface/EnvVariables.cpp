@@ -1,9 +1,11 @@
 #include <climits>
+#include <cstdlib>
 #include "torch_npu/csrc/core/npu/NPUException.h"
 
 #include "third_party/acl/inc/acl/acl_mdl.h"
 #include "torch_npu/csrc/framework/utils/ForceJitCompileList.h"
 #include "torch_npu/csrc/framework/utils/ForceAclnnList.h"
+#include "torch_npu/csrc/framework/OpHook.h"
 #include "torch_npu/csrc/framework/interface/AclOpCompileInterface.h"
 #include "torch_npu/csrc/framework/aoe/AoeUtils.h"
 #include "torch_npu/csrc/core/npu/npu_log.h"
@@ -129,6 +131,26 @@ bool CheckOpHookEnable() {
     return GET_OPTION_WITH_CACHE(isOpHookEnable);
 }
 
+REGISTER_OPTION_HOOK(OP_HOOK_OP_LIST, [](const std::string &val) {
+    OpHook::GetInstance().SetOpList(val);
+})
+
+REGISTER_OPTION_HOOK(OP_HOOK_SAMPLE_INTERVAL, [](const std::string &val) {
+    char *end = nullptr;
+    uint64_t interval = std::strtoull(val.c_str(), &end, 10);
+    TORCH_CHECK(!val.empty() && *end == '\0', "OP_HOOK_SAMPLE_INTERVAL should be an integer, but got ", val,
+                PTA_ERROR(ErrCode::VALUE));
+    OpHook::GetInstance().SetSampleInterval(interval);
+})
+
+REGISTER_OPTION_HOOK(OP_HOOK_SAMPLE_RATE, [](const std::string &val) {
+    char *end = nullptr;
+    double rate = std::strtod(val.c_str(), &end);
+    TORCH_CHECK(!val.empty() && *end == '\0', "OP_HOOK_SAMPLE_RATE should be a number, but got ", val,
+                PTA_ERROR(ErrCode::VALUE));
+    OpHook::GetInstance().SetSampleRate(rate);
+})
+
 REGISTER_OPTION(MM_BMM_ND_ENABLE)
 REGISTER_OPTION_BOOL_FUNCTION_UNIQ(CheckMmBmmNDDisable, MM_BMM_ND_ENABLE, "enable", "disable")
 
@@ -18,6 +18,11 @@
 #include "torch_npu/csrc/core/npu/NPUGuard.h"
 #include "torch_npu/csrc/core/npu/DeviceUtils.h"
 #include "torch_npu/csrc/core/npu/NPUException.h"
+#include "torch_npu/csrc/core/npu/NPUEvent.h"
+#include "torch_npu/csrc/core/npu/NPUCachingAllocator.h"
+#include "torch_npu/csrc/core/npu/NPUPeerToPeerAccess.h"
+#include "torch_npu/csrc/core/npu/interface/AsyncTaskQueueInterface.h"
+#include "torch_npu/csrc/framework/FormatHelper.h"
 
 namespace torch_npu {
 using namespace at;
@@ -362,6 +367,72 @@ tensor_list2d broadcast_coalesced(TensorList tensors, IntArrayRef devices, size_
     return outputs;
 }
 
+// Peer copies
+// copy_() between two devices synchronizes the destination stream before and the
+// source stream after every chunk on the host, so scatter and gather used to
+// serialize on one device at a time. When both devices can access each other,
+// each chunk is instead packed once on its own device and moved with a single
+// device-to-device memcpy on the destination stream, ordered by events, so all
+// devices are issued before anything waits.
+static bool can_peer_copy(const at::Tensor& dst, const at::Tensor& src)
+{
+    if (!torch_npu::utils::is_npu(dst) || !torch_npu::utils::is_npu(src)) {
+        return false;
+    }
+    if (dst.scalar_type() != src.scalar_type() || dst.sizes() != src.sizes() || dst.strides() != src.strides() ||
+        !src.is_non_overlapping_and_dense()) {
+        return false;
+    }
+    if (!at_npu::native::FormatHelper::IsBaseFormatType(dst) ||
+        !at_npu::native::FormatHelper::IsBaseFormatType(src)) {
+        return false;
+    }
+    if (dst.get_device() == src.get_device()) {
+        return true;
+    }
+    bool warning_flag = false;
+    return at_npu::native::NpuP2pCtrl::get_instance().get_p2p_access(src.get_device(), dst.get_device(), warning_flag);
+}
+
+// Makes `stream` wait for `src_ready` and copies src into dst on it. src is read
+// from another device's stream, so its block is kept alive until the copy ran.
+static void peer_copy_async(const at::Tensor& dst, const at::Tensor& src, c10_npu::NPUEvent& src_ready,
+    const c10_npu::NPUStream& stream)
+{
+    size_t nbytes = static_cast<size_t>(src.numel()) * src.element_size();
+    if (nbytes == 0) {
+        return;
+    }
+    c10_npu::NPUStreamGuard guard(stream);
+    src_ready.block(stream);
+    NPU_CHECK_ERROR(c10_npu::queue::LaunchAsyncCopyTask(dst.data_ptr(), nbytes, src.data_ptr(), nbytes,
+        ACL_MEMCPY_DEVICE_TO_DEVICE));
+    c10_npu::NPUCachingAllocator::recordStream(src.storage().data_ptr(), stream);
+}
+
+static at::Tensor pack_for_peer_copy(const at::Tensor& chunk)
+{
+    auto memory_format = chunk.suggest_memory_format();
+    return chunk.is_contiguous(memory_format) ? chunk : chunk.contiguous(memory_format);
+}
+
+static c10_npu::NPUStream scatter_stream(
+    const c10::optional<std::vector<c10::optional<c10_npu::NPUStream>>>& streams, size_t i, int16_t device_index)
+{
+    if (i < (streams ? streams->size() : 0U) && (*streams)[i]) {
+        TORCH_CHECK((*streams)[i]->device_index() == device_index,
+            "Expected the device associated with the stream at index ",
+            i,
+            " (was ",
+            (*streams)[i]->device_index(),
+            ") to match the device supplied at that index (expected ",
+            device_index,
+            ")" + PTA_ERROR(ErrCode::VALUE));
+        return *(*streams)[i];
+    }
+    return c10_npu::getCurrentNPUStream(device_index);
+}
+
 // Scatter
 std::vector<at::Tensor>& scatter_out(const at::Tensor& tensor, std::vector<at::Tensor>& out_tensors, int64_t dim,
     const c10::optional<std::vector<c10::optional<c10_npu::NPUStream>>>& streams)
@@ -407,25 +478,40 @@ std::vector<at::Tensor>& scatter_out(const at::Tensor& tensor, std::vector<at::T
         total_size, PTA_ERROR(ErrCode::VALUE));
 
     auto chunks = tensor.split_with_sizes(chunk_sizes, dim);
+    std::vector<c10_npu::NPUStream> copy_streams;
+    copy_streams.reserve(chunks.size());
+    for (const auto i : c10::irange(chunks.size())) {
+        copy_streams.emplace_back(
+            scatter_stream(streams, i, static_cast<int16_t>(out_tensors[i].get_device())));
+    }
+
+    // NB: We don't detect the case where `out_tensor` is already the correct
+    //     view of `tensor` since that would be nontrivial and involve checking
+    //     ptr, offset, and strides. So `scatter_out(src, src.chunk(...))` does
+    //     more copying than `scatter(src)`.
+    std::vector<at::Tensor> packed(chunks.size());
+    bool any_peer_copy = false;
+    for (const auto i : c10::irange(chunks.size())) {
+        if (torch_npu::utils::is_npu(tensor) && out_tensors[i].is_non_overlapping_and_dense()) {
+            auto chunk = pack_for_peer_copy(chunks[i]);
+            if (can_peer_copy(out_tensors[i], chunk)) {
+                packed[i] = std::move(chunk);
+                any_peer_copy = true;
+            }
+        }
+    }
+    c10_npu::NPUEvent src_ready;
+    if (any_peer_copy) {
+        src_ready.record(c10_npu::getCurrentNPUStream(tensor.get_device()));
+    }
+
     c10_npu::OptionalNPUStreamGuard npu_guard;
     for (const auto i : c10::irange(chunks.size())) {
-        if (i < (streams ? streams->size() : 0U) && (*streams)[i]) {
-            const auto device_index = static_cast<int16_t>(out_tensors[i].get_device());
-            TORCH_CHECK((*streams)[i]->device_index() == device_index,
-                "Expected the device associated with the stream at index ",
-                i,
-                " (was ",
-                (*streams)[i]->device_index(),
-                ") ",
-                "to match the device supplied at that index (expected ",
-                device_index,
-                ")" + PTA_ERROR(ErrCode::VALUE));
-            npu_guard.reset_stream(*(*streams)[i]);
+        if (packed[i].defined()) {
+            peer_copy_async(out_tensors[i], packed[i], src_ready, copy_streams[i]);
+            continue;
         }
-        // NB: We don't detect the case where `out_tensor` is already the correct
-        //     view of `tensor` since that would be nontrivial and involve checking
-        //     ptr, offset, and strides. So `scatter_out(src, src.chunk(...))` does
-        //     more copying than `scatter(src)`.
+        npu_guard.reset_stream(copy_streams[i]);
         out_tensors[i].copy_(chunks[i], true);
     }
     return out_tensors;
@@ -448,25 +534,46 @@ std::vector<at::Tensor> scatter(const at::Tensor& tensor, at::IntArrayRef device
     std::vector<at::Tensor> chunks = chunk_sizes
         ? tensor.split_with_sizes(*chunk_sizes, dim)
         : tensor.chunk(devices.size(), dim);
-    c10_npu::OptionalNPUStreamGuard npu_guard;
+    // Pack every outgoing chunk on the source device first, so that a single event
+    // orders all the peer copies after it.
+    std::vector<at::Tensor> packed(chunks.size());
+    std::vector<c10::optional<c10_npu::NPUStream>> copy_streams(chunks.size());
+    bool any_peer_copy = false;
+    for (const auto i : c10::irange(chunks.size())) {
+        const auto device_index = static_cast<int16_t>(devices[i]);
+        if (device_index == tensor.get_device()) {
+            continue;
+        }
+        TORCH_CHECK(device_index >= 0, "Expected non-negative device index, but got ", device_index, PTA_ERROR(ErrCode::VALUE));
+        copy_streams[i] = scatter_stream(streams, i, device_index);
+        if (torch_npu::utils::is_npu(tensor)) {
+            packed[i] = pack_for_peer_copy(chunks[i]);
+            any_peer_copy = true;
+        }
+    }
+    c10_npu::NPUEvent src_ready;
+    if (any_peer_copy) {
+        src_ready.record(c10_npu::getCurrentNPUStream(tensor.get_device()));
+    }
 
+    c10_npu::OptionalNPUStreamGuard npu_guard;
     for (const auto i : c10::irange(chunks.size())) {
         const auto device_index = static_cast<int16_t>(devices[i]);
-        if (device_index != tensor.get_device()) {
-            if (i < (streams ? streams->size() : 0U) && (*streams)[i]) {
-                TORCH_CHECK((*streams)[i]->device_index() == device_index,
-                    "Expected the device associated with the stream at index ",
-                    i,
-                    " (was ",
-                    (*streams)[i]->device_index(),
-                    ") to match the device supplied at that index (expected ",
-                    device_index,
-                    ")" + PTA_ERROR(ErrCode::VALUE));
-                npu_guard.reset_stream(*(*streams)[i]);
+        if (device_index == tensor.get_device()) {
+            continue;
+        }
+        npu_guard.reset_stream(*copy_streams[i]);
+        if (packed[i].defined()) {
+            // Allocated on the copy stream, so the caching allocator hands the same
+            // blocks back on the next iteration once the previous batch is released.
+            auto out = at::empty_like(packed[i], packed[i].options().device(DeviceType::PrivateUse1, device_index));
+            if (can_peer_copy(out, packed[i])) {
+                peer_copy_async(out, packed[i], src_ready, *copy_streams[i]);
+                chunks[i] = std::move(out);
+                continue;
             }
-            TORCH_CHECK(device_index >= 0, "Expected non-negative device index, but got ", device_index, PTA_ERROR(ErrCode::VALUE));
-            chunks[i] = chunks[i].to({DeviceType::PrivateUse1, device_index}, true, false);
         }
+        chunks[i] = chunks[i].to({DeviceType::PrivateUse1, device_index}, true, false);
     }
     return chunks;
 }
@@ -481,8 +588,47 @@ static inline at::Tensor& _gather_out_impl(at::TensorList tensors, at::Tensor& o
         chunk_sizes.emplace_back(tensor.size(dim));
     }
     auto chunks = out_tensor.split_with_sizes(chunk_sizes, dim);
+    if (!torch_npu::utils::is_npu(out_tensor)) {
+        for (const auto i : c10::irange(tensors.size())) {
+            chunks[i].copy_(tensors[i], false);
+        }
+        return out_tensor;
+    }
+
+    // Every input is packed on its own device and moved with one peer copy on the
+    // destination stream, either straight into its slice of the output when that
+    // slice is dense, or into a staging buffer that a single cat lays out.
+    const auto out_device = out_tensor.device();
+    bool direct = dim == 0 && out_tensor.is_contiguous();
+    std::vector<at::Tensor> packed(tensors.size());
+    std::vector<at::Tensor> targets(tensors.size());
     for (const auto i : c10::irange(tensors.size())) {
-        chunks[i].copy_(tensors[i], torch_npu::utils::is_npu(out_tensor));
+        packed[i] = direct ? tensors[i].contiguous() : pack_for_peer_copy(tensors[i]);
+        if (direct) {
+            targets[i] = chunks[i];
+        } else {
+            c10_npu::NPUGuard device_guard(out_device);
+            targets[i] = at::empty_like(packed[i], packed[i].options().device(out_device));
+        }
+        if (!can_peer_copy(targets[i], packed[i])) {
+            for (const auto j : c10::irange(tensors.size())) {
+                chunks[j].copy_(tensors[j], true);
+            }
+            return out_tensor;
+        }
+    }
+
+    std::vector<c10_npu::NPUEvent> src_ready(tensors.size());
+    for (const auto i : c10::irange(tensors.size())) {
+        src_ready[i].record(c10_npu::getCurrentNPUStream(packed[i].get_device()));
+    }
+    auto stream = c10_npu::getCurrentNPUStream(out_device.index());
+    for (const auto i : c10::irange(tensors.size())) {
+        peer_copy_async(targets[i], packed[i], src_ready[i], stream);
+    }
+    if (!direct) {
+        c10_npu::NPUGuard device_guard(out_device);
+        at::cat_out(out_tensor, targets, dim);
     }
     return out_tensor;
 }
@@ -43,6 +43,8 @@
 #include "torch_npu/csrc/profiler/msprof_tx.h"
 #include "torch_npu/csrc/npu/memory_snapshot.h"
 #include "torch_npu/csrc/core/npu/interface/OpInterface.h"
+#include "torch_npu/csrc/framework/OpHostStats.h"
+#include "torch_npu/csrc/framework/OpDeviceTimer.h"
 #include "op_plugin/utils/custom_functions/opapi/FFTCommonOpApi.h"
 
 struct NPUDeviceProp {
@@ -1257,6 +1259,72 @@ PyObject* THNPModule_npu_clear_fft_plan_cache(PyObject* self, PyObject* noargs)
     END_HANDLE_TH_ERRORS
 }
 
+PyObject* THNPModule_npu_set_op_host_stats_enabled(PyObject* self, PyObject* arg)
+{
+    HANDLE_TH_ERRORS
+    TORCH_CHECK(PyBool_Check(arg), "set_op_host_stats_enabled expects a bool, but got ", THPUtils_typename(arg),
+                PTA_ERROR(ErrCode::TYPE));
+    at_npu::native::OpHostStats::GetInstance().SetEnabled(arg == Py_True);
+    Py_RETURN_NONE;
+    END_HANDLE_TH_ERRORS
+}
+
+PyObject* THNPModule_npu_is_op_host_stats_enabled(PyObject* self, PyObject* noargs)
+{
+    HANDLE_TH_ERRORS
+    return PyBool_FromLong(at_npu::native::OpHostStats::GetInstance().IsEnabled());
+    END_HANDLE_TH_ERRORS
+}
+
+PyObject* THNPModule_npu_op_host_stats(PyObject* self, PyObject* arg)
+{
+    HANDLE_TH_ERRORS
+    TORCH_CHECK(PyBool_Check(arg), "op_host_stats expects reset to be a bool, but got ", THPUtils_typename(arg),
+                PTA_ERROR(ErrCode::TYPE));
+    auto rows = at_npu::native::OpHostStats::GetInstance().Snapshot(arg == Py_True);
+    static const char* phase_names[] = {"build", "queue_wait", "launch", "device"};
+    py::list result;
+    for (const auto& row : rows) {
+        py::dict op;
+        op["op_name"] = row.opName;
+        for (size_t i = 0; i < row.phases.size(); ++i) {
+            const auto& phase = row.phases[i];
+            py::dict stats;
+            stats["count"] = phase.count;
+            stats["total_us"] = phase.totalUs;
+            stats["avg_us"] = phase.count > 0 ? phase.totalUs / static_cast<double>(phase.count) : 0.0;
+            stats["max_us"] = phase.maxUs;
+            stats["p50_us"] = phase.p50Us;
+            stats["p90_us"] = phase.p90Us;
+            stats["p99_us"] = phase.p99Us;
+            op[phase_names[i]] = stats;
+        }
+        result.append(op);
+    }
+    return result.release().ptr();
+    END_HANDLE_TH_ERRORS
+}
+
+PyObject* THNPModule_npu_set_op_device_timing_interval(PyObject* self, PyObject* arg)
+{
+    HANDLE_TH_ERRORS
+    TORCH_CHECK(THPUtils_checkLong(arg), "set_op_device_timing_interval expects an int, but got ",
+                THPUtils_typename(arg), PTA_ERROR(ErrCode::TYPE));
+    int64_t interval = THPUtils_unpackLong(arg);
+    TORCH_CHECK(interval >= 0 && interval <= UINT32_MAX, "interval should be in [0, ", UINT32_MAX, "], but got ",
+                interval, PTA_ERROR(ErrCode::VALUE));
+    at_npu::native::OpDeviceTimer::GetInstance().SetInterval(static_cast<uint32_t>(interval));
+    Py_RETURN_NONE;
+    END_HANDLE_TH_ERRORS
+}
+
+PyObject* THNPModule_npu_get_op_device_timing_interval(PyObject* self, PyObject* noargs)
+{
+    HANDLE_TH_ERRORS
+    return PyLong_FromUnsignedLong(at_npu::native::OpDeviceTimer::GetInstance().GetInterval());
+    END_HANDLE_TH_ERRORS
+}
+
 static struct PyMethodDef THNPModule_methods[] = {
     {"_npu_init", (PyCFunction)THNPModule_initExtension, METH_NOARGS, nullptr},
     {"_npu_set_run_yet_variable_to_false", (PyCFunction)THNPModule_set_run_yet_variable_to_false_wrap, METH_NOARGS, nullptr},
@@ -1312,6 +1380,11 @@ static struct PyMethodDef THNPModule_methods[] = {
     {"_npu_get_fft_plan_cache_max_size", (PyCFunction)THNPModule_npu_get_fft_plan_cache_max_size, METH_NOARGS, nullptr},
     {"_npu_get_fft_plan_cache_size", (PyCFunction)THNPModule_npu_get_fft_plan_cache_size, METH_NOARGS, nullptr},
     {"_npu_clear_fft_plan_cache", (PyCFunction)THNPModule_npu_clear_fft_plan_cache, METH_NOARGS, nullptr},
+    {"_npu_set_op_host_stats_enabled", (PyCFunction)THNPModule_npu_set_op_host_stats_enabled, METH_O, nullptr},
+    {"_npu_is_op_host_stats_enabled", (PyCFunction)THNPModule_npu_is_op_host_stats_enabled, METH_NOARGS, nullptr},
+    {"_npu_op_host_stats", (PyCFunction)THNPModule_npu_op_host_stats, METH_O, nullptr},
+    {"_npu_set_op_device_timing_interval", (PyCFunction)THNPModule_npu_set_op_device_timing_interval, METH_O, nullptr},
+    {"_npu_get_op_device_timing_interval", (PyCFunction)THNPModule_npu_get_op_device_timing_interval, METH_NOARGS, nullptr},
     {nullptr}};
 
 TORCH_NPU_API PyMethodDef* THNPModule_get_methods()
@@ -35,17 +35,22 @@ PyObject* profiler_initExtension(PyObject* _unused, PyObject *unused) {
         .value("NPU", NpuActivityType::NPU);
 
     py::class_<ExperimentalConfig>(m, "_ExperimentalConfig")
-        .def(py::init<std::string, std::string, bool, bool, bool, bool>(),
+        .def(py::init<std::string, std::string, bool, bool, bool, bool, bool, uint32_t, uint32_t>(),
              py::arg("trace_level") = "Level0",
              py::arg("metrics") = "ACL_AICORE_NONE",
              py::arg("l2_cache") = false,
              py::arg("record_op_args") = false,
              py::arg("msprof_tx") = false,
-             py::arg("op_attr") = false
+             py::arg("op_attr") = false,
+             py::arg("compress_fwk_data") = false,
+             py::arg("python_sample_interval_us") = 0,
+             py::arg("memory_aggregate_interval_us") = 0
         )
         .def(py::pickle(
             [](const ExperimentalConfig& p) {
-                return py::make_tuple(p.trace_level, p.metrics, p.l2_cache, p.record_op_args, p.msprof_tx, p.op_attr);
+                return py::make_tuple(p.trace_level, p.metrics, p.l2_cache, p.record_op_args, p.msprof_tx, p.op_attr,
+                                      p.compress_fwk_data, p.python_sample_interval_us,
+                                      p.memory_aggregate_interval_us);
             },
             [](py::tuple t) {
                 if (t.size() < 6) {  // 6表示ExperimentalConfig的配置有六项
@@ -57,7 +62,10 @@ PyObject* profiler_initExtension(PyObject* _unused, PyObject *unused) {
                     t[2].cast<bool>(),
                     t[3].cast<bool>(),
                     t[4].cast<bool>(),
-                    t[5].cast<bool>()
+                    t[5].cast<bool>(),
+                    t.size() > 6 ? t[6].cast<bool>() : false,
+                    t.size() > 7 ? t[7].cast<uint32_t>() : 0,
+                    t.size() > 8 ? t[8].cast<uint32_t>() : 0
                 );
             }
         ));
@@ -79,6 +87,9 @@ PyObject* profiler_initExtension(PyObject* _unused, PyObject *unused) {
         py::arg("scopes") = std::unordered_set<at::RecordScope>());
     m.def("_stop_profiler", stopNpuProfiler);
     m.def("_finalize_profiler", finalizeNpuProfiler);
+    m.def("_get_dropped_records", []() {
+        return torch_npu::profiler::ProfilerMgr::GetInstance()->GetDroppedRecords();
+    });
     m.def("_get_freq", at_npu::native::getFreq);
     m.def("_get_syscnt_enable", at_npu::native::isSyscntEnable);
     m.def("_get_syscnt", torch_npu::toolkit::profiler::Utils::getClockSyscnt);
@@ -138,10 +149,24 @@ PyObject* THNPModule_rangeEnd(PyObject* self, PyObject* args)
     END_HANDLE_TH_ERRORS
 }
 
+PyObject* THNPModule_setDomainEnable(PyObject* self, PyObject* args)
+{
+    HANDLE_TH_ERRORS
+    char *domain;
+    int enable = 1;
+    if (!PyArg_ParseTuple(args, "sp", &domain, &enable)) {
+        return nullptr;
+    }
+    MstxMgr::GetInstance()->setDomainEnable(domain, enable != 0);
+    Py_RETURN_NONE;
+    END_HANDLE_TH_ERRORS
+}
+
 static std::vector<PyMethodDef> mstxMethods = {
     {"_range_start_on_host", (PyCFunction)THNPModule_rangeStartOnHost, METH_VARARGS, nullptr},
     {"_range_start", (PyCFunction)THNPModule_rangeStart, METH_VARARGS, nullptr},
     {"_range_end", (PyCFunction)THNPModule_rangeEnd, METH_VARARGS, nullptr},
+    {"_set_domain_enable", (PyCFunction)THNPModule_setDomainEnable, METH_VARARGS, nullptr},
     {nullptr, nullptr, 0, nullptr}
 };
 
@@ -0,0 +1,127 @@
+#include "torch_npu/csrc/profiler/memory_aggregator.h"
+#include "torch_npu/csrc/profiler/npu_profiler.h"
+#include "torch_npu/csrc/profiler/profiler_mgr.h"
+#include "torch_npu/csrc/toolkit/profiler/common/utils.h"
+
+namespace torch_npu {
+namespace profiler {
+using torch_npu::toolkit::profiler::MemoryAggregateData;
+using torch_npu::toolkit::profiler::MemoryAggregateRecord;
+using torch_npu::toolkit::profiler::Utils;
+
+void MemoryAggregator::Start(uint32_t interval_us)
+{
+    for (auto &shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.counters.clear();
+    }
+    // Quanta are measured on the monotonic clock, the record timestamps may be
+    // system counter ticks.
+    interval_ns_.store(static_cast<uint64_t>(interval_us) * 1000);
+    quantum_end_ns_.store(Utils::GetClockMonotonicRawNs() + interval_ns_.load());
+    enabled_.store(interval_us > 0);
+}
+
+void MemoryAggregator::Stop()
+{
+    if (!enabled_.exchange(false)) {
+        return;
+    }
+    // Record checks enabled_ under the shard lock, nothing is added once a
+    // shard has been taken.
+    FlushAll();
+}
+
+bool MemoryAggregator::Record(const MemoryUsage &data, int64_t time_ns)
+{
+    if (!enabled_.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    uint64_t now = Utils::GetClockMonotonicRawNs();
+    uint64_t quantum_end = quantum_end_ns_.load(std::memory_order_relaxed);
+    if (now >= quantum_end &&
+        quantum_end_ns_.compare_exchange_strong(quantum_end, now + interval_ns_.load(std::memory_order_relaxed))) {
+        FlushAll();
+    }
+    Key key{data.stream_ptr, data.device_type, data.device_index, data.allocator_type};
+    Shard &shard = ShardOf(key);
+    std::vector<MemoryAggregateRecord> records;
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (!enabled_.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        auto result = shard.counters.try_emplace(key);
+        MemoryAggregateRecord &record = result.first->second;
+        bool reserved_changed = !result.second && data.total_reserved != record.total_reserved;
+        if (result.second) {
+            record.start_ns = time_ns;
+            record.stream_ptr = data.stream_ptr;
+            record.process_id = Utils::GetPid();
+            record.device_type = data.device_type;
+            record.device_index = data.device_index;
+            record.allocator_type = data.allocator_type;
+        }
+        if (data.data_type == static_cast<uint8_t>(MemoryDataType::MEMORY_MALLOC)) {
+            record.alloc_count++;
+            record.alloc_bytes += data.alloc_size;
+        } else if (data.data_type == static_cast<uint8_t>(MemoryDataType::MEMORY_FREE)) {
+            // Frees are reported with a negative size.
+            record.free_count++;
+            record.free_bytes -= data.alloc_size;
+        }
+        if (result.second || data.total_allocated > record.peak_allocated) {
+            record.peak_ns = time_ns;
+            record.peak_allocated = data.total_allocated;
+            record.peak_reserved = data.total_reserved;
+            record.peak_active = data.total_active;
+        }
+        record.end_ns = time_ns;
+        record.total_allocated = data.total_allocated;
+        record.total_reserved = data.total_reserved;
+        record.total_active = data.total_active;
+        if (reserved_changed) {
+            records.push_back(record);
+            shard.counters.erase(result.first);
+        }
+    }
+    Report(std::move(records));
+    return true;
+}
+
+MemoryAggregator::Shard &MemoryAggregator::ShardOf(const Key &key)
+{
+    // KeyHash keeps the low bits of the aligned stream pointers, take the high
+    // bits of a multiplicative hash instead.
+    uint64_t hash = static_cast<uint64_t>(KeyHash()(key)) * 0x9E3779B97F4A7C15ULL;
+    return shards_[hash >> (64 - kShardBits)];
+}
+
+void MemoryAggregator::TakeAll(Shard &shard, std::vector<MemoryAggregateRecord> &records)
+{
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    records.reserve(records.size() + shard.counters.size());
+    for (const auto &counter : shard.counters) {
+        records.push_back(counter.second);
+    }
+    shard.counters.clear();
+}
+
+void MemoryAggregator::FlushAll()
+{
+    std::vector<MemoryAggregateRecord> records;
+    for (auto &shard : shards_) {
+        TakeAll(shard, records);
+    }
+    Report(std::move(records));
+}
+
+void MemoryAggregator::Report(std::vector<MemoryAggregateRecord> records)
+{
+    if (records.empty()) {
+        return;
+    }
+    ProfilerMgr::GetInstance()->UploadWithLock(std::make_unique<MemoryAggregateData>(std::move(records)));
+}
+} // profiler
+} // torch_npu
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "torch_npu/csrc/toolkit/profiler/common/singleton.h"
+#include "torch_npu/csrc/toolkit/profiler/inc/data_reporter.h"
+
+namespace torch_npu {
+namespace profiler {
+struct MemoryUsage;
+
+// Folds the allocator events of a profile_memory session into running
+// counters per (device, stream, allocator type), reported as one
+// MemoryAggregateData per interval instead of one MemoryData per event. A
+// change of the reserved memory closes the counters of its stream right away,
+// so the reserved steps of the memory timeline stay exact.
+//
+// The counters are sharded by key, so allocator events of different streams
+// only contend when they land on the same shard. The first event after the
+// end of a quantum closes the counters of all shards, idle streams included.
+// When no event at all follows, the last quantum stays open until Stop, and
+// its end_ns is then the time of its last event rather than the quantum end.
+class MemoryAggregator : public torch_npu::toolkit::profiler::Singleton<MemoryAggregator> {
+friend class torch_npu::toolkit::profiler::Singleton<MemoryAggregator>;
+public:
+    // An interval of 0 keeps reporting every event.
+    void Start(uint32_t interval_us);
+    // Reports the open counters, call before the data dumpers stop.
+    void Stop();
+    // Returns false if not aggregating, the event is then reported on its own.
+    bool Record(const MemoryUsage &data, int64_t time_ns);
+
+private:
+    struct Key {
+        int64_t stream_ptr;
+        int8_t device_type;
+        int8_t device_index;
+        uint8_t allocator_type;
+        bool operator==(const Key &other) const
+        {
+            return stream_ptr == other.stream_ptr && device_type == other.device_type &&
+                   device_index == other.device_index && allocator_type == other.allocator_type;
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key &key) const
+        {
+            return std::hash<int64_t>()(key.stream_ptr) ^
+                   (static_cast<size_t>(static_cast<uint8_t>(key.device_type)) << 16 |
+                    static_cast<size_t>(static_cast<uint8_t>(key.device_index)) << 8 |
+                    static_cast<size_t>(key.allocator_type));
+        }
+    };
+
+    struct alignas(64) Shard {
+        std::mutex mutex;
+        std::unordered_map<Key, torch_npu::toolkit::profiler::MemoryAggregateRecord, KeyHash> counters;
+    };
+
+    static constexpr size_t kShardBits = 4;
+
+    MemoryAggregator() = default;
+    Shard &ShardOf(const Key &key);
+    void TakeAll(Shard &shard, std::vector<torch_npu::toolkit::profiler::MemoryAggregateRecord> &records);
+    void FlushAll();
+    void Report(std::vector<torch_npu::toolkit::profiler::MemoryAggregateRecord> records);
+
+    std::atomic<bool> enabled_{false};
+    std::atomic<uint64_t> interval_ns_{0};
+    std::atomic<uint64_t> quantum_end_ns_{0};
+    std::array<Shard, 1 << kShardBits> shards_;
+};
+} // profiler
+} // torch_npu
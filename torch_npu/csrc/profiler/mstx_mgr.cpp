@@ -3,6 +3,7 @@
 #include "torch_npu/csrc/core/npu/NPUFunctions.h"
 #include "torch_npu/csrc/framework/interface/MstxInterface.h"
 #include "torch_npu/csrc/core/npu/npu_log.h"
+#include "torch_npu/csrc/core/npu/NPUException.h"
 #include "torch_npu/csrc/framework/OpCommand.h"
 #include "torch_npu/csrc/profiler/profiler_mgr.h"
 #include "torch_npu/csrc/toolkit/profiler/common/utils.h"
@@ -11,13 +12,17 @@
 
 namespace torch_npu {
 namespace profiler {
+namespace {
+const char* const kMstxDomainNames[MSTX_DOMAIN_COUNT] = {"default", "communication"};
+}
+
 MstxMgr::MstxMgr()
 {
 }
 
 void MstxMgr::mark(const char* message, const aclrtStream stream)
 {
-    if (!isMstxEnable()) {
+    if (!isDomainEnable(MSTX_DOMAIN_DEFAULT)) {
         return;
     }
     int id = ptRangeId_++;
@@ -34,7 +39,7 @@ void MstxMgr::mark(const char* message, const aclrtStream stream)
 
 int MstxMgr::rangeStart(const char* message, const aclrtStream stream)
 {
-    if (!isMstxEnable()) {
+    if (!isDomainEnable(MSTX_DOMAIN_DEFAULT)) {
         return 0;
     }
     int id = ptRangeId_++;
@@ -84,6 +89,58 @@ int MstxMgr::getRangeId()
     return ptRangeId_++;
 }
 
+void MstxMgr::setDomainEnable(const std::string& name, bool enable)
+{
+    for (uint32_t domain = 0; domain < MSTX_DOMAIN_COUNT; ++domain) {
+        if (name == kMstxDomainNames[domain]) {
+            if (enable) {
+                domainMask_.fetch_or(1U << domain);
+            } else {
+                domainMask_.fetch_and(~(1U << domain));
+            }
+            return;
+        }
+    }
+    TORCH_CHECK(false, "Unknown mstx domain ", name, ", expected default or communication.",
+                PROF_ERROR(ErrCode::PARAM));
+}
+
+mstxDomainhandle_t MstxMgr::getDomainHandle(MstxDomainId domain)
+{
+    mstxDomainhandle_t handle = domainHandles_[domain].load(std::memory_order_acquire);
+    if (handle != nullptr) {
+        return handle;
+    }
+    handle = getDomainHandle(kMstxDomainNames[domain]);
+    domainHandles_[domain].store(handle, std::memory_order_release);
+    return handle;
+}
+
+mstxDomainhandle_t MstxMgr::getDomainHandle(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(internMtx_);
+    auto iter = namedDomainHandles_.find(name);
+    if (iter != namedDomainHandles_.end()) {
+        return iter->second;
+    }
+    mstxDomainhandle_t handle = createDomain(name.c_str());
+    namedDomainHandles_.emplace(name, handle);
+    return handle;
+}
+
+const char* MstxMgr::internCommMessage(const std::string& message)
+{
+    std::lock_guard<std::mutex> lock(internMtx_);
+    auto iter = commMessages_.find(message);
+    if (iter != commMessages_.end()) {
+        return iter->c_str();
+    }
+    if (commMessages_.size() >= kMaxCommMessages) {
+        return nullptr;
+    }
+    return commMessages_.insert(message).first->c_str();
+}
+
 mstxDomainhandle_t MstxMgr::createDomain(const char* name)
 {
     return at_npu::native::MstxDomainCreateA(name);
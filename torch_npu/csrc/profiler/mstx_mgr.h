@@ -1,7 +1,10 @@
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <cstdint>
 #include <mutex>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include "torch_npu/csrc/framework/interface/MstxInterface.h"
@@ -11,7 +14,15 @@
 namespace torch_npu {
 namespace profiler {
 
-const std::string DOMAIN_COMMUNICATION = "communication";
+// Domains of the markers emitted by torch_npu. Each has a bit in the mask of
+// enabled domains, which callers check before building any message.
+enum MstxDomainId : uint8_t {
+    MSTX_DOMAIN_DEFAULT = 0,
+    MSTX_DOMAIN_COMMUNICATION,
+    MSTX_DOMAIN_COUNT
+};
+
+constexpr MstxDomainId DOMAIN_COMMUNICATION = MSTX_DOMAIN_COMMUNICATION;
 
 class MstxMgr : public torch_npu::toolkit::profiler::Singleton<MstxMgr> {
 friend class torch_npu::toolkit::profiler::Singleton<MstxMgr>;
@@ -22,6 +33,22 @@ public:
     bool isMstxEnable();
     int getRangeId();
 
+    // All domains are enabled by default.
+    void setDomainEnable(const std::string& name, bool enable);
+    bool isDomainEnable(MstxDomainId domain)
+    {
+        return (domainMask_.load(std::memory_order_relaxed) & (1U << domain)) != 0 && isMstxEnable();
+    }
+    // Created on first use and kept for the lifetime of the process.
+    mstxDomainhandle_t getDomainHandle(MstxDomainId domain);
+    mstxDomainhandle_t getDomainHandle(const std::string& name);
+    // Interns the messages of the communication domain only, user messages
+    // are copied into their tasks. Returns the same pointer, valid until exit,
+    // for equal messages and nullptr once kMaxCommMessages are interned.
+    const char* internCommMessage(const std::string& message);
+
+    static constexpr size_t kMaxCommMessages = 4096;
+
     mstxDomainhandle_t createDomain(const char* name);
     void destroyDomain(mstxDomainhandle_t domain);
     void domainMark(mstxDomainhandle_t domain, const char* message, const aclrtStream stream);
@@ -42,6 +69,11 @@ private:
     std::atomic<int> ptRangeId_{1};
     std::unordered_set<int> ptRangeIdsWithStream_;
     std::mutex mtx_;
+    std::atomic<uint32_t> domainMask_{UINT32_MAX};
+    std::array<std::atomic<mstxDomainhandle_t>, MSTX_DOMAIN_COUNT> domainHandles_{};
+    std::unordered_map<std::string, mstxDomainhandle_t> namedDomainHandles_;
+    std::unordered_set<std::string> commMessages_;
+    std::mutex internMtx_;
 };
 
 }
@@ -7,6 +7,7 @@
 #include "torch_npu/csrc/core/npu/npu_log.h"
 #include "torch_npu/csrc/core/npu/NPUException.h"
 #include "torch_npu/csrc/profiler/npu_profiler.h"
+#include "torch_npu/csrc/profiler/memory_aggregator.h"
 
 #include "torch_npu/csrc/toolkit/profiler/common/utils.h"
 #include "torch_npu/csrc/toolkit/profiler/inc/data_reporter.h"
@@ -316,8 +317,11 @@ void startNpuProfiler(const NpuProfilerConfig &config,
     ExperimentalConfig experimental_config = config.experimental_config;
     NpuTraceConfig npu_config = {experimental_config.trace_level, experimental_config.metrics,
         config.profile_memory, experimental_config.l2_cache, experimental_config.record_op_args,
-        experimental_config.msprof_tx, experimental_config.op_attr};
+        experimental_config.msprof_tx, experimental_config.op_attr, experimental_config.compress_fwk_data,
+        experimental_config.python_sample_interval_us};
     ProfilerMgr::GetInstance()->Start(npu_config, cpu_trace);
+    MemoryAggregator::GetInstance()->Start(
+        cpu_trace && config.profile_memory ? experimental_config.memory_aggregate_interval_us : 0);
     if (state->tracePython()) {
         python_tracer::call(python_tracer::Command::kStartAll);
     }
@@ -341,6 +345,7 @@ void stopNpuProfiler()
         python_tracer::call(python_tracer::Command::kStop);
         python_tracer::call(python_tracer::Command::kClear);
     }
+    MemoryAggregator::GetInstance()->Stop();
     ProfilerMgr::GetInstance()->Stop();
 }
 
@@ -366,9 +371,13 @@ void reportMemoryDataToNpuProfiler(const MemoryUsage& data)
     if (!ProfilerMgr::GetInstance()->ReportMemEnable().load()) {
         return;
     }
+    int64_t time_ns = static_cast<int64_t>(Utils::GetClockTime());
+    if (MemoryAggregator::GetInstance()->Record(data, time_ns)) {
+        return;
+    }
     ProfilerMgr::GetInstance()->UploadWithLock(std::make_unique<torch_npu::toolkit::profiler::MemoryData>(
         data.ptr,
-        static_cast<int64_t>(Utils::GetClockTime()),
+        time_ns,
         data.alloc_size,
         data.total_allocated,
         data.total_reserved,
@@ -54,13 +54,17 @@ struct MemoryUsage {
 struct ExperimentalConfig {
     ExperimentalConfig(std::string level = "Level0", std::string metrics = "ACL_AICORE_NONE",
                        bool l2_cache = false, bool record_op_args = false, bool msprof_tx = false,
-                       bool op_attr = false)
+                       bool op_attr = false, bool compress_fwk_data = false,
+                       uint32_t python_sample_interval_us = 0, uint32_t memory_aggregate_interval_us = 0)
         : trace_level(level),
           metrics(metrics),
           l2_cache(l2_cache),
           record_op_args(record_op_args),
           msprof_tx(msprof_tx),
-          op_attr(op_attr) {}
+          op_attr(op_attr),
+          compress_fwk_data(compress_fwk_data),
+          python_sample_interval_us(python_sample_interval_us),
+          memory_aggregate_interval_us(memory_aggregate_interval_us) {}
     ~ExperimentalConfig() = default;
 
     std::string trace_level;
@@ -69,6 +73,9 @@ struct ExperimentalConfig {
     bool record_op_args;
     bool msprof_tx;
     bool op_attr;
+    bool compress_fwk_data;
+    uint32_t python_sample_interval_us;
+    uint32_t memory_aggregate_interval_us;
 };
 
 struct NpuProfilerConfig {
@@ -137,13 +144,29 @@ struct MstxRange {
         }
         rangeId = MstxMgr::GetInstance()->getRangeId();
         if (at_npu::native::IsSupportMstxDomainFunc()) {
-            domainHandle = MstxMgr::GetInstance()->createDomain(domainName.c_str());
+            domainHandle = MstxMgr::GetInstance()->getDomainHandle(domainName);
             at_npu::native::MstxDomainRangeStartA(domainHandle, message.c_str(), stream, rangeId);
         } else {
             at_npu::native::MstxRangeStartA(message.c_str(), stream, rangeId);
         }
     }
 
+    // For the markers of torch_npu itself: an empty message, as returned by
+    // message builders that found the domain disabled, starts no range.
+    MstxRange(const char *message, aclrtStream stream, MstxDomainId domain)
+    {
+        if (message == nullptr || message[0] == '\0' || !MstxMgr::GetInstance()->isDomainEnable(domain)) {
+            return;
+        }
+        rangeId = MstxMgr::GetInstance()->getRangeId();
+        if (at_npu::native::IsSupportMstxDomainFunc()) {
+            domainHandle = MstxMgr::GetInstance()->getDomainHandle(domain);
+            at_npu::native::MstxDomainRangeStartA(domainHandle, message, stream, rangeId);
+        } else {
+            at_npu::native::MstxRangeStartA(message, stream, rangeId);
+        }
+    }
+
     ~MstxRange()
     {
         if (rangeId == 0 || !mstxEnable()) {
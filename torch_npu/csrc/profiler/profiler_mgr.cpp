@@ -34,7 +34,7 @@ std::map<std::string, uint64_t> ProfilerMgr::trace_level_map_ = {
     {"Level_none", Level_none},
 };
 
-constexpr uint32_t capacity_ = 1048576;          // 2^20, Experience value for default ringbuffer size for single data
+constexpr uint32_t capacity_ = 1024;             // 2^10, chunks of kReportChunkSize, 64 MB of encoded records
 constexpr uint32_t trace_capacity_ = 128;        // 2^7, Experience value for python trace data ringbuffer size for batch data
 
 aclprofAicoreMetrics CheckAicMetricsFeature(aclprofAicoreMetrics aic_metrics, int8_t level)
@@ -131,7 +131,8 @@ void ProfilerMgr::Start(const NpuTraceConfig &npu_config, bool cpu_trace)
     if (cpu_trace == true) {
         std::string fwk_path = path_ + "/FRAMEWORK";
         if (Utils::CreateDir(fwk_path)) {
-            StartDataReceiver(fwk_path);
+            StartDataReceiver(fwk_path, npu_config.compress_fwk_data);
+            python_sample_interval_us_.store(npu_config.python_sample_interval_us);
             report_enable_.store(true);
             profile_memory_.store(npu_config.npu_memory);
         } else {
@@ -152,6 +153,7 @@ void ProfilerMgr::Stop() {
   if (report_enable_.load() == true) {
     StopDataReceiver();
     profile_memory_.store(false);
+    python_sample_interval_us_.store(0);
   }
   report_enable_.store(false);
   if (npu_trace_.load() == true) {
@@ -176,13 +178,14 @@ void ProfilerMgr::Finalize() {
   npu_trace_.store(false);
 }
 
-void ProfilerMgr::StartDataReceiver(const std::string &fwk_path)
+void ProfilerMgr::StartDataReceiver(const std::string &fwk_path, bool compress)
 {
-    dataReceiver_.Init(fwk_path, capacity_);
+    dataReceiver_.Init(fwk_path, capacity_, compress);
     dataReceiver_.Start();
-    traceDataReceiver_.Init(fwk_path, trace_capacity_);
+    traceDataReceiver_.Init(fwk_path, trace_capacity_, compress);
     traceDataReceiver_.Start();
-    dataReceiverWithLock_.Init(fwk_path, capacity_);
+    // Memory records are reported under reportDataMutex_, keep them in that order.
+    dataReceiverWithLock_.Init(fwk_path, capacity_, compress, true);
     dataReceiverWithLock_.Start();
 }
 
@@ -196,6 +199,12 @@ void ProfilerMgr::StopDataReceiver()
     dataReceiverWithLock_.UnInit();
 }
 
+uint64_t ProfilerMgr::GetDroppedRecords()
+{
+    return dataReceiver_.GetDroppedCount() + traceDataReceiver_.GetDroppedCount() +
+           dataReceiverWithLock_.GetDroppedCount();
+}
+
 void ProfilerMgr::Upload(std::unique_ptr<torch_npu::toolkit::profiler::BaseReportData> data)
 {
     dataReceiver_.Report(std::move(data));
@@ -222,6 +231,11 @@ void ProfilerMgr::UploadParamData(std::unique_ptr<torch_npu::toolkit::profiler::
     traceDataReceiver_.ReportParam(std::move(data));
 }
 
+void ProfilerMgr::UploadTraceSampleData(std::unique_ptr<torch_npu::toolkit::profiler::PythonSampleData> data)
+{
+    traceDataReceiver_.ReportSample(std::move(data));
+}
+
 uint64_t ProfilerMgr::CheckFeatureConfig(uint64_t datatype_config)
 {
     if (!FeatureMgr::GetInstance()->IsSupportFeature(FeatureType::FEATURE_ATTR)) {
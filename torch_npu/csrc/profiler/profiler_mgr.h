@@ -24,6 +24,8 @@ struct NpuTraceConfig {
   bool record_op_args;
   bool msprof_tx;
   bool op_attr;
+  bool compress_fwk_data;
+  uint32_t python_sample_interval_us;
 };
 
 C10_NPU_API int8_t GetTraceLevel();
@@ -39,7 +41,10 @@ public:
     void UploadTraceEventData(std::unique_ptr<torch_npu::toolkit::profiler::PythonTracerFuncData> data);
     void UploadTraceHashData(std::unique_ptr<torch_npu::toolkit::profiler::PythonTracerHashData> data);
     void UploadParamData(std::unique_ptr<torch_npu::toolkit::profiler::ParamTensorData> data);
+    void UploadTraceSampleData(std::unique_ptr<torch_npu::toolkit::profiler::PythonSampleData> data);
     int8_t GetTraceLevel();
+    // Records the framework data dumpers lost in the last profiling session.
+    uint64_t GetDroppedRecords();
     static ProfilerMgr *GetInstance();
     std::atomic<bool>& GetNpuTrace()
     {
@@ -61,6 +66,12 @@ public:
         return profile_memory_;
     }
 
+    // Interval of the python stack sampler, 0 when python calls are traced.
+    uint32_t GetPythonSampleInterval() const
+    {
+        return python_sample_interval_us_.load();
+    }
+
 private:
     ProfilerMgr();
     explicit ProfilerMgr(const ProfilerMgr &obj) = delete;
@@ -69,7 +80,7 @@ private:
     ProfilerMgr& operator=(ProfilerMgr &&obj) = delete;
     void EnableMsProfiler(uint32_t *deviceIdList, uint32_t deviceNum, aclprofAicoreMetrics aicMetrics, uint64_t dataTypeConfig);
     uint64_t CheckFeatureConfig(uint64_t datatype_config);
-    void StartDataReceiver(const std::string &fwk_path);
+    void StartDataReceiver(const std::string &fwk_path, bool compress);
     void StopDataReceiver();
 
 private:
@@ -81,6 +92,7 @@ private:
     std::atomic<bool> profile_memory_;
     std::atomic<bool> msprof_tx_;
     std::atomic<int8_t> trace_level_;
+    std::atomic<uint32_t> python_sample_interval_us_{0};
     std::string path_;
     aclprofConfig *profConfig_;
     torch_npu::toolkit::profiler::DataDumper dataReceiver_;
@@ -1,8 +1,15 @@
 #include "torch_npu/csrc/profiler/containers.h"
 #include "torch_npu/csrc/profiler/profiler_python.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <deque>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 
@@ -31,10 +38,12 @@ const std::string EXIT_EVENT_DESC = "__torch_npu_profiler_python_tracer_exit";
 const size_t EXIT_EVENT_HASH_ID = c10::get_hash(EXIT_EVENT_DESC);               // Special hash key for exit event
 const std::string MODULE_NAME_DELIMITER = "######";
 constexpr size_t TRACE_DUMP_THRESHOLD = 1024 * DEFAULT_BLOCK_SIZE;
+constexpr size_t STACK_MAX_DEPTH = 128;
 
 using TensorMetadata = torch_npu::toolkit::profiler::TensorMetadata;
 using ModuleParam = torch_npu::toolkit::profiler::ModuleParam;
 using OptimizerParam = torch_npu::toolkit::profiler::OptimizerParam;
+using PythonSampleNode = torch_npu::toolkit::profiler::PythonSampleNode;
 
 std::string trimPrefix(std::string s)
 {
@@ -170,6 +179,13 @@ struct PyCallInfo {
         func_name_ = THPUtils_unpackStringView(f_code->co_name).data();
     }
 
+    // Identifies the function rather than the line being run, used for samples.
+    explicit PyCallInfo(PyCodeObject* f_code) : line_no_(f_code->co_firstlineno)
+    {
+        file_name_ = THPUtils_unpackStringView(f_code->co_filename).data();
+        func_name_ = THPUtils_unpackStringView(f_code->co_name).data();
+    }
+
     size_t get_hash_id()
     {
         return c10::get_hash(line_no_, file_name_, func_name_);
@@ -225,8 +241,33 @@ public:
         uint64_t ts_{0};
     };
 
+    // Call tree of the stacks sampled on one thread, node 0 is the root.
+    struct SampleTree {
+        struct Node {
+            uint64_t key{0};
+            uint32_t parent{0};
+            uint64_t count{0};
+        };
+
+        uint32_t child(uint32_t parent, uint64_t key)
+        {
+            auto it = children_.find(std::make_tuple(parent, key));
+            if (it != children_.end()) {
+                return it->second;
+            }
+            auto index = static_cast<uint32_t>(nodes_.size());
+            nodes_.push_back({key, parent, 0});
+            children_.emplace(std::make_tuple(parent, key), index);
+            return index;
+        }
+
+        std::vector<Node> nodes_{Node()};
+        std::unordered_map<std::tuple<uint32_t, uint64_t>, uint32_t, c10::hash<std::tuple<uint32_t, uint64_t>>> children_;
+    };
+
 private:
     PythonTracer();
+    ~PythonTracer();
     static PythonTracer& singleton();
 
     void start(size_t max_threads = max_py_threads);
@@ -240,6 +281,11 @@ private:
     void reportTraceData();
     void reportHashData();
     void reportParamData();
+    void startSampling(size_t max_threads);
+    void stopSampling();
+    void sampleLoop();
+    void sampleStacks();
+    void reportSampleData();
 
 private:
     std::atomic<bool> active_{false};
@@ -256,6 +302,18 @@ private:
     AppendOnlyList<TraceEvent> events_;
     std::unordered_map<uintptr_t, std::vector<StartPyCall>> start_py_call_info_;
     std::unordered_map<uintptr_t, uint64_t> ctx_tid_map_;
+
+    // Sampling mode, a timer thread walks the frame stacks of the python threads
+    // every sample_interval_us_ instead of tracing each call.
+    uint32_t sample_interval_us_{0};
+    size_t max_sample_threads_{0};
+    std::atomic<bool> sampling_{false};
+    std::thread sampler_;
+    std::mutex sample_mutex_;
+    std::condition_variable sample_cv_;
+    std::vector<uint64_t> sample_stack_;
+    std::unordered_map<uint64_t, SampleTree> sample_trees_;
+    std::unordered_map<size_t, std::string> sample_name_cache_;
 };
 
 PythonTracer& PythonTracer::singleton()
@@ -279,6 +337,16 @@ PythonTracer::PythonTracer() : active_(false)
         .ptr();
 }
 
+PythonTracer::~PythonTracer()
+{
+    // Profiler never stopped: at exit the sampler may be blocked on the GIL of a
+    // finalized interpreter, leave it rather than join.
+    if (sampler_.joinable()) {
+        sampling_ = false;
+        sampler_.detach();
+    }
+}
+
 void PythonTracer::start(size_t max_threads)
 {
     TORCH_CHECK(thread_local_results_.empty(), "PythonTracer should not have active contexts", PROF_ERROR(ErrCode::INTERNAL));
@@ -309,7 +377,12 @@ void PythonTracer::start(size_t max_threads)
         thread_states.resize(max_threads);
     }
 
-    const size_t STACK_MAX_DEPTH = 128;
+    sample_interval_us_ = ProfilerMgr::GetInstance()->GetPythonSampleInterval();
+    if (sample_interval_us_ > 0) {
+        startSampling(max_threads);
+        return;
+    }
+
     // Register the tracer in each thread.
     for (const auto thread_state : thread_states) {
         PyThreadState_Swap(thread_state);
@@ -343,6 +416,15 @@ void PythonTracer::stop()
 {
     TORCH_INTERNAL_ASSERT(active_.load(), "PythonTracer is not running.", PROF_ERROR(ErrCode::INTERNAL));
 
+    if (sample_interval_us_ > 0) {
+        stopSampling();
+        pybind11::gil_scoped_acquire gil;
+        active_ = false;
+        reportSampleData();
+        reportHashData();
+        return;
+    }
+
     pybind11::gil_scoped_acquire gil;
     for (const auto thread_state : getInterpreterThreads(interpreter_)) {
         if (thread_state->c_profilefunc == &PythonTracer::pyProfileFn) {
@@ -380,6 +462,9 @@ void PythonTracer::clear()
     ctx_tid_map_.clear();
     start_py_call_info_.clear();
     thread_local_results_.clear();
+    sample_trees_.clear();
+    sample_name_cache_.clear();
+    sample_interval_us_ = 0;
     interpreter_ = nullptr;
 }
 
@@ -399,7 +484,8 @@ void PythonTracer::reportTraceData()
 void PythonTracer::reportHashData()
 {
     std::vector<std::pair<uint64_t, std::string>> hash_data;
-    hash_data.resize(py_call_cache_.size() + pyc_call_cache_.size() + module_info_cache_.size() + 1);
+    hash_data.resize(py_call_cache_.size() + pyc_call_cache_.size() + module_info_cache_.size() +
+                     sample_name_cache_.size() + 1);
     size_t idx = 0;
     for (auto& item : py_call_cache_) {
         hash_data[idx++] = std::make_pair(item.first, trimPrefix(item.second.get_name()));
@@ -410,6 +496,9 @@ void PythonTracer::reportHashData()
     for (auto& item : module_info_cache_) {
         hash_data[idx++] = std::make_pair(item.first, item.second.get_name());
     }
+    for (auto& item : sample_name_cache_) {
+        hash_data[idx++] = std::make_pair(item.first, trimPrefix(item.second));
+    }
     hash_data[idx] = std::make_pair(EXIT_EVENT_HASH_ID, EXIT_EVENT_DESC);
 
     ProfilerMgr::GetInstance()->UploadTraceHashData(
@@ -433,6 +522,102 @@ void PythonTracer::reportParamData()
     optimizer_param_cache_.clear();
 }
 
+void PythonTracer::startSampling(size_t max_threads)
+{
+    max_sample_threads_ = max_threads;
+    sampling_ = true;
+    sampler_ = std::thread(&PythonTracer::sampleLoop, this);
+}
+
+void PythonTracer::stopSampling()
+{
+    {
+        std::lock_guard<std::mutex> lock(sample_mutex_);
+        sampling_ = false;
+    }
+    sample_cv_.notify_all();
+    if (!sampler_.joinable()) {
+        return;
+    }
+    // The sampler may be waiting for the GIL held by the caller.
+    if (PyGILState_Check()) {
+        pybind11::gil_scoped_release no_gil;
+        sampler_.join();
+    } else {
+        sampler_.join();
+    }
+}
+
+void PythonTracer::sampleLoop()
+{
+    const auto interval = std::chrono::microseconds(sample_interval_us_);
+    auto next = std::chrono::steady_clock::now() + interval;
+    std::unique_lock<std::mutex> lock(sample_mutex_);
+    while (!sample_cv_.wait_until(lock, next, [this] { return !sampling_.load(); })) {
+        lock.unlock();
+        sampleStacks();
+        lock.lock();
+        // Skip the ticks missed while waiting for the GIL rather than catching up.
+        next = std::max(next + interval, std::chrono::steady_clock::now());
+    }
+}
+
+void PythonTracer::sampleStacks()
+{
+    if (!Py_IsInitialized()) {
+        return;
+    }
+    pybind11::gil_scoped_acquire gil;
+    if (!sampling_.load()) {
+        return;
+    }
+    size_t sampled_threads = 0;
+    auto* thread_state = PyInterpreterState_ThreadHead(interpreter_);
+    for (; thread_state != nullptr && sampled_threads < max_sample_threads_;
+         thread_state = PyThreadState_Next(thread_state)) {
+        THPFrameObjectPtr frame(PyThreadState_GetFrame(thread_state));
+        if (!frame) {
+            continue;
+        }
+        ++sampled_threads;
+        sample_stack_.clear();
+        while (frame && sample_stack_.size() < STACK_MAX_DEPTH) {
+            auto call_info = PyCallInfo(PyFrame_GetCode_NPU(frame.get()).get());
+            auto hash_id = call_info.get_hash_id();
+            if (sample_name_cache_.find(hash_id) == sample_name_cache_.end()) {
+                sample_name_cache_.emplace(hash_id, call_info.get_name());
+            }
+            sample_stack_.push_back(hash_id);
+            frame = THPFrameObjectPtr(PyFrame_GetBack(frame.get()));
+        }
+        auto& tree = sample_trees_[thread_state->thread_id];
+        uint32_t node = 0;
+        for (auto it = sample_stack_.rbegin(); it != sample_stack_.rend(); ++it) {
+            node = tree.child(node, *it);
+        }
+        tree.nodes_[node].count++;
+    }
+}
+
+void PythonTracer::reportSampleData()
+{
+    std::vector<PythonSampleNode> nodes;
+    for (const auto& item : sample_trees_) {
+        const auto& tree_nodes = item.second.nodes_;
+        for (uint32_t i = 1; i < tree_nodes.size(); ++i) {
+            nodes.push_back({item.first, tree_nodes[i].key, tree_nodes[i].count, i, tree_nodes[i].parent});
+        }
+    }
+    if (!nodes.empty()) {
+        ProfilerMgr::GetInstance()->UploadTraceSampleData(
+            std::make_unique<torch_npu::toolkit::profiler::PythonSampleData>(
+                sample_interval_us_,
+                std::move(nodes)
+            )
+        );
+    }
+}
+
 void PythonTracer::recordEvent(TraceTag tag, size_t hash_key)
 {
     events_.emplace_back(
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <memory>
 #include <vector>
 #include <deque>
 
@@ -31,6 +32,7 @@ public:
     capacity_ = capacity;
     mask_ = capacity_ - 1;
     data_queue_.resize(capacity);
+    ready_.reset(new std::atomic<bool>[capacity]());
     is_inited_ = true;
     is_quit_ = false;
   }
@@ -39,6 +41,7 @@ public:
     {
         if (is_inited_) {
             data_queue_.clear();
+            ready_.reset();
             read_index_ = 0;
             write_index_ = 0;
             idle_write_index_ = 0;
@@ -74,7 +77,8 @@ public:
         cycles_exceed_cnt_.fetch_add(1, std::memory_order_relaxed);
         return false;
       }
-      curr_read_index = read_index_.load(std::memory_order_relaxed);
+      // Acquire, the slot is reused only after the consumer moved out of it.
+      curr_read_index = read_index_.load(std::memory_order_acquire);
       curr_write_index = idle_write_index_.load(std::memory_order_relaxed);
       next_write_index = curr_write_index + 1;
       if ((next_write_index & mask_) == (curr_read_index & mask_)) {
@@ -84,6 +88,9 @@ public:
     } while (!idle_write_index_.compare_exchange_weak(curr_write_index, next_write_index));
     size_t index = curr_write_index & mask_;
     data_queue_[index] = std::move(data);
+    // Producers fill their claimed slots in any order, the consumer must not
+    // take a slot before its producer is done with it.
+    ready_[index].store(true, std::memory_order_release);
     write_index_++;
     return true;
   }
@@ -98,7 +105,11 @@ public:
       return false;
     }
     size_t index = curr_read_index & mask_;
+    if (!ready_[index].load(std::memory_order_acquire)) {
+      return false;
+    }
     data = std::move(data_queue_[index]);
+    ready_[index].store(false, std::memory_order_relaxed);
     read_index_++;
     return true;
   }
@@ -122,6 +133,7 @@ private:
   size_t capacity_;
   size_t mask_;
   std::vector<T> data_queue_;
+  std::unique_ptr<std::atomic<bool>[]> ready_;
 
   // Ringbuffer push failed info
   std::atomic<size_t> cycles_exceed_cnt_;
@@ -1,63 +1,144 @@
 #pragma once
 #include <atomic>
+#include <chrono>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 #include <condition_variable>
 
 #include "torch_npu/csrc/toolkit/profiler/common/thread.h"
 #include "torch_npu/csrc/toolkit/profiler/common/ring_buffer.h"
 #include "torch_npu/csrc/toolkit/profiler/inc/data_reporter.h"
+#include "torch_npu/csrc/toolkit/profiler/inc/segment_file.h"
 
 namespace torch_npu {
 namespace toolkit {
 namespace profiler {
 constexpr uint32_t kDefaultRingBuffer = 1024;
 constexpr uint32_t kBatchMaxLen = 5 * 1024 * 1024; // 5 MB
-constexpr uint32_t kMaxWaitTimeUs = 1024;
+constexpr uint32_t kMaxWaitTimeMs = 100;
 constexpr uint32_t kNotifyInterval = 256;
+constexpr size_t kReportChunkSize = 64 * 1024;
+constexpr size_t kReportChunkHeadroom = 4 * 1024;
+
+// Wakes a dumper thread once its ring buffer holds `watermark` records, instead
+// of the dumper polling it. The watermark doubles while producers keep waking
+// the dumper, so heavy tracing is written in large batches, up to a quarter of
+// the ring to leave room for bursts, and drops back once the dumper times out.
+class DumpNotifier {
+public:
+    void Init(size_t minWatermark, size_t capacity);
+    // Producer side, with the ring size after a successful push.
+    void OnPush(size_t size)
+    {
+        if (size >= watermark_.load(std::memory_order_relaxed) && !pending_.exchange(true)) {
+            Notify();
+        }
+    }
+    void Wake();
+    // Dumper side. Returns false if the timeout passed without a wakeup.
+    bool Wait(std::chrono::milliseconds timeout);
+
+private:
+    void Notify();
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::atomic<bool> pending_{false};
+    std::atomic<size_t> watermark_{kNotifyInterval};
+    size_t min_watermark_{kNotifyInterval};
+    size_t max_watermark_{kNotifyInterval};
+};
+
+// Encoded records of one tag. A producer encodes records in place into a
+// chunk reserved at kReportChunkSize and hands it to the dumper by pointer
+// once less than kReportChunkHeadroom is left; a larger record grows the
+// chunk instead. The dumper writes the chunk out and recycles it.
+struct ReportChunk {
+    std::string tag;
+    std::vector<uint8_t> data;
+    uint64_t records{0};
+};
+
+// The open chunks, one per tag, of the thread bound to it. The mutex is only
+// contended when the dumper seals the chunks of an idle producer.
+struct ChunkProducer {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ReportChunk>> chunks;
+    std::atomic<bool> bound{false};
+};
 
 class DataDumper : public Thread {
 public:
   explicit DataDumper();
   virtual ~DataDumper();
-  void Init(const std::string &path, size_t capacity);
+  // With compress set, files are written as compressed segments, see segment_file.h.
+  // capacity is the number of chunks the ring buffer holds. Records are
+  // encoded by the reporting thread into its own chunks, so the records of
+  // different threads are written in chunk order; with shareChunks set all
+  // threads fill the same chunks, which keeps the order of reports the
+  // callers already serialize.
+  void Init(const std::string &path, size_t capacity, bool compress = false, bool shareChunks = false);
   void UnInit();
   void Report(std::unique_ptr<BaseReportData> data);
   void Start();
   void Stop();
+  // Records lost since Init because the ring buffer was full.
+  uint64_t GetDroppedCount() const;
 
 private:
+  ChunkProducer &GetProducer();
+  std::unique_ptr<ReportChunk> AcquireChunk(const std::string &tag);
+  void RecycleChunk(std::unique_ptr<ReportChunk> chunk);
+  void HandOff(std::unique_ptr<ReportChunk> chunk);
+  void SealChunks();
   void Flush();
-  void Dump(const std::map<std::string, std::vector<uint8_t>> &dataMap);
+  void Dump(const std::string &tag, const std::vector<uint8_t> &data);
   void Run();
-  void GatherAndDumpData();
+  // Returns false once no chunk could be popped.
+  bool GatherAndDumpData();
 
 private:
+  const uint64_t id_;
   std::string path_;
   std::atomic<bool> start_;
   std::atomic<bool> init_;
-  RingBuffer<std::unique_ptr<BaseReportData>> data_chunk_buf_;
+  bool share_chunks_{false};
+  RingBuffer<std::unique_ptr<ReportChunk>> data_chunk_buf_;
+  std::mutex free_mutex_;
+  std::vector<std::unique_ptr<ReportChunk>> free_chunks_;
+  std::mutex producers_mutex_;
+  std::vector<std::shared_ptr<ChunkProducer>> producers_;
+  std::shared_ptr<ChunkProducer> shared_producer_;
+  DumpNotifier notifier_;
+  std::atomic<uint64_t> dropped_{0};
+  bool compress_{false};
   std::map<std::string, FILE*> fd_map_;
+  std::map<std::string, std::unique_ptr<SegmentFile>> segment_map_;
 };
 
 class TraceDataDumper : public Thread {
 public:
     explicit TraceDataDumper();
     virtual ~TraceDataDumper();
-    void Init(const std::string &path, size_t capacity);
+    void Init(const std::string &path, size_t capacity, bool compress = false);
     void UnInit();
     void Report(std::unique_ptr<PythonTracerFuncData> data);
     void ReportHash(std::unique_ptr<PythonTracerHashData> data);
     void ReportParam(std::unique_ptr<ParamTensorData> data);
+    void ReportSample(std::unique_ptr<PythonSampleData> data);
     void Start();
     void Stop();
+    uint64_t GetDroppedCount() const;
 
 private:
     void CreateDumpDir();
-    void FlushTraceData();
+    bool FlushTraceData();
     void FlushHashData();
     void FlushParamData();
+    void FlushSampleData();
     void Dump(const std::string& file_name, const std::vector<uint8_t>& encode_data);
     void Run();
 
@@ -67,8 +148,14 @@ private:
     std::atomic<bool> init_;
     std::unique_ptr<PythonTracerHashData> trace_hash_data_{nullptr};
     std::unique_ptr<ParamTensorData> param_data_{nullptr};
+    std::unique_ptr<PythonSampleData> sample_data_{nullptr};
     RingBuffer<std::unique_ptr<PythonTracerFuncData>> trace_data_buf_;
+    std::vector<uint8_t> encode_buf_;
+    DumpNotifier notifier_;
+    std::atomic<uint64_t> dropped_{0};
+    bool compress_{false};
     std::map<std::string, FILE*> fd_map_;
+    std::map<std::string, std::unique_ptr<SegmentFile>> segment_map_;
 };
 } // profiler
 } // toolkit
@@ -4,6 +4,7 @@
 #include "torch_npu/csrc/profiler/profiler_python.h"
 
 #include <stdint.h>
+#include <initializer_list>
 #include <vector>
 #include <unordered_map>
 #include <string>
@@ -25,36 +26,51 @@ std::string to_string(T value) {
 }
 
 template<typename T>
-void encodeFixedData(const std::vector<T> &datas, std::vector<uint8_t> &result) {
+void encodeFixedData(std::initializer_list<T> datas, std::vector<uint8_t> &result) {
+  size_t offset = result.size();
+  result.resize(offset + datas.size() * sizeof(T));
+  uint8_t *dst = result.data() + offset;
   for (auto data : datas) {
     for (size_t i = 0; i < sizeof(T); ++i) {
-      result.push_back((static_cast<size_t>(data) >> (i * 8)) & 0xff);
+      *dst++ = (static_cast<size_t>(data) >> (i * 8)) & 0xff;
     }
   }
 }
 
-inline void encodeStrData(uint16_t type, const std::string &data, std::vector<uint8_t> &result) {
-  for (size_t i = 0; i < sizeof(uint16_t); ++i) {
-    result.push_back((type >> (i * 8)) & 0xff);
-  }
-  uint32_t length = data.size();
+// Writes the type and a placeholder length of a TLV record and returns the
+// offset of the header, to be passed to encodeTLVEnd once the value is written.
+inline size_t encodeTLVBegin(uint16_t type, std::vector<uint8_t> &result) {
+  size_t offset = result.size();
+  encodeFixedData<uint16_t>({type}, result);
+  encodeFixedData<uint32_t>({0}, result);
+  return offset;
+}
+
+inline void encodeTLVEnd(size_t offset, std::vector<uint8_t> &result) {
+  uint32_t length = result.size() - offset - sizeof(uint16_t) - sizeof(uint32_t);
+  uint8_t *dst = result.data() + offset + sizeof(uint16_t);
   for (size_t i = 0; i < sizeof(uint32_t); ++i) {
-    result.push_back((length >> (i * 8)) & 0xff);
-  }
-  for (const auto &c : data) {
-    result.push_back(c);
+    dst[i] = (length >> (i * 8)) & 0xff;
   }
 }
 
+inline void encodeStrData(uint16_t type, const std::string &data, std::vector<uint8_t> &result) {
+  encodeFixedData<uint16_t>({type}, result);
+  encodeFixedData<uint32_t>({static_cast<uint32_t>(data.size())}, result);
+  result.insert(result.end(), data.cbegin(), data.cend());
+}
+
+// Same layout as encodeStrData of the ';' joined strings, without building the
+// joined string first.
 inline void encodeStrArrayData(uint16_t type, const std::vector<std::string> &datas, std::vector<uint8_t> &result) {
-  std::string rst;
-  for (auto str : datas) {
-    rst += (str + ";");
-  }
-  if (!rst.empty()) {
-    rst.pop_back();
+  size_t offset = encodeTLVBegin(type, result);
+  for (size_t i = 0; i < datas.size(); ++i) {
+    if (i > 0) {
+      result.push_back(';');
+    }
+    result.insert(result.end(), datas[i].cbegin(), datas[i].cend());
   }
-  encodeStrData(type, rst, result);
+  encodeTLVEnd(offset, result);
 }
 
 inline void encodeMapData(uint16_t type, const std::unordered_map<std::string, c10::IValue> &datas, std::vector<uint8_t> &result) {
@@ -69,21 +85,21 @@ inline void encodeMapData(uint16_t type, const std::unordered_map<std::string, c
 }
 
 template<typename T>
-void encode2DIntegerMatrixDatas(uint16_t type, std::vector<std::vector<T>> &datas, std::vector<uint8_t> &result) {
-  std::string rst;
-  for (auto tensor : datas) {
-    std::stringstream ss;
-    copy(tensor.begin(), tensor.end(), std::ostream_iterator<T>(ss, ","));
-    std::string str = ss.str();
-    if (!str.empty()) {
-      str.pop_back();
+void encode2DIntegerMatrixDatas(uint16_t type, const std::vector<std::vector<T>> &datas, std::vector<uint8_t> &result) {
+  size_t offset = encodeTLVBegin(type, result);
+  for (size_t i = 0; i < datas.size(); ++i) {
+    if (i > 0) {
+      result.push_back(';');
+    }
+    for (size_t j = 0; j < datas[i].size(); ++j) {
+      if (j > 0) {
+        result.push_back(',');
+      }
+      const std::string value = std::to_string(datas[i][j]);
+      result.insert(result.end(), value.cbegin(), value.cend());
     }
-    rst += (str + ";");
-  }
-  if (!rst.empty()) {
-    rst.pop_back();
   }
-  encodeStrData(type, rst, result);
+  encodeTLVEnd(offset, result);
 }
 
 class WeakTensor {
@@ -169,7 +185,7 @@ inline void encodeTensor(const TensorMetadata &t, std::ostringstream &oss)
     oss << to_string(t.device_index_);
 }
 
-inline void encodeTensors(uint16_t type, std::vector<TensorMetadata> tensors, std::vector<uint8_t> &result)
+inline void encodeTensors(uint16_t type, const std::vector<TensorMetadata> &tensors, std::vector<uint8_t> &result)
 {
     std::ostringstream oss;
     for (auto& tensor: tensors) {
@@ -180,7 +196,7 @@ inline void encodeTensors(uint16_t type, std::vector<TensorMetadata> tensors, st
     encodeStrData(type, str, result);
 }
 
-inline void encodeTensorLists(uint16_t type, std::vector<std::vector<TensorMetadata>> tensorlists, std::vector<uint8_t> &result)
+inline void encodeTensorLists(uint16_t type, const std::vector<std::vector<TensorMetadata>> &tensorlists, std::vector<uint8_t> &result)
 {
     std::ostringstream oss;
     for (auto& tensorlist: tensorlists) {
@@ -194,7 +210,7 @@ inline void encodeTensorLists(uint16_t type, std::vector<std::vector<TensorMetad
     encodeStrData(type, str, result);
 }
 
-inline void encodeModuleParams(uint16_t type, std::vector<ModuleParam> params, std::vector<uint8_t> &result)
+inline void encodeModuleParams(uint16_t type, const std::vector<ModuleParam> &params, std::vector<uint8_t> &result)
 {
     std::ostringstream oss;
     for (auto& param: params) {
@@ -210,7 +226,7 @@ inline void encodeModuleParams(uint16_t type, std::vector<ModuleParam> params, s
     encodeStrData(type, str, result);
 }
 
-inline void encodeOptimizerParams(uint16_t type, std::vector<OptimizerParam> params, std::vector<uint8_t> &result)
+inline void encodeOptimizerParams(uint16_t type, const std::vector<OptimizerParam> &params, std::vector<uint8_t> &result)
 {
     std::ostringstream oss;
     for (auto& param: params) {
@@ -220,7 +236,7 @@ inline void encodeOptimizerParams(uint16_t type, std::vector<OptimizerParam> par
             encodeTensor(*(param.grad_), oss);
         }
         oss << ")";
-        for (auto s : param.state_) {
+        for (const auto &s : param.state_) {
             appendWithDelimiter(oss, s.first, '>');
             encodeTensor(s.second, oss);
             oss << "]";
@@ -237,7 +253,8 @@ struct BaseReportData {
     BaseReportData(int32_t device_id, std::string tag)
         : device_id(device_id), tag(std::move(tag)) {}
     virtual ~BaseReportData() = default;
-    virtual std::vector<uint8_t> encode() = 0;
+    // Appends the encoded record to result, which is reused across records.
+    virtual void encode(std::vector<uint8_t> &result) = 0;
 };
 
 enum class FwkDataType {
@@ -300,7 +317,7 @@ struct OpRangeData : BaseReportData{
           forward_thread_id(forward_thread_id),
           is_async(is_async),
           name(std::move(name)) {}
-    std::vector<uint8_t> encode();
+    void encode(std::vector<uint8_t> &result) override;
 };
 
 enum class OpMarkDataType {
@@ -328,7 +345,7 @@ struct OpMarkData : BaseReportData {
           thread_id(thread_id),
           process_id(process_id),
           name(name) {}
-    std::vector<uint8_t> encode();
+    void encode(std::vector<uint8_t> &result) override;
 };
 
 struct MemoryData : BaseReportData {
@@ -373,7 +390,39 @@ struct MemoryData : BaseReportData {
           allocator_type(allocator_type),
           thread_id(thread_id),
           process_id(process_id) {}
-    std::vector<uint8_t> encode();
+    void encode(std::vector<uint8_t> &result) override;
+};
+
+// Allocator events of one (device, stream, allocator) over a time quantum:
+// the alloc and free deltas, the totals when allocated memory peaked and the
+// totals after the last event.
+struct MemoryAggregateRecord {
+    int64_t start_ns{0};
+    int64_t end_ns{0};
+    int64_t peak_ns{0};
+    int64_t stream_ptr{0};
+    int64_t alloc_bytes{0};
+    int64_t free_bytes{0};
+    uint64_t alloc_count{0};
+    uint64_t free_count{0};
+    int64_t peak_allocated{0};
+    int64_t peak_reserved{0};
+    int64_t peak_active{0};
+    int64_t total_allocated{0};
+    int64_t total_reserved{0};
+    int64_t total_active{0};
+    uint64_t process_id{0};
+    int8_t device_type{0};
+    int8_t device_index{0};
+    uint8_t allocator_type{0};
+};
+
+struct MemoryAggregateData : BaseReportData {
+    std::vector<MemoryAggregateRecord> records;
+    explicit MemoryAggregateData(std::vector<MemoryAggregateRecord> records)
+        : BaseReportData(0, "torch.memory_aggregate"),
+          records(std::move(records)) {}
+    void encode(std::vector<uint8_t> &result) override;
 };
 
 struct PythonTracerFuncData : BaseReportData {
@@ -385,7 +434,7 @@ struct PythonTracerFuncData : BaseReportData {
         : BaseReportData(0, "torch.python_tracer_func"),
           process_id(process_id),
           events(std::move(events)) {}
-    std::vector<uint8_t> encode();
+    void encode(std::vector<uint8_t> &result) override;
 };
 
 enum class PythonTracerHashDataType {
@@ -397,7 +446,27 @@ struct PythonTracerHashData : BaseReportData {
     PythonTracerHashData(std::vector<std::pair<uint64_t, std::string>> hash_data)
         : BaseReportData(0, "torch.python_tracer_hash"),
           hash_data(std::move(hash_data)) {}
-    std::vector<uint8_t> encode();
+    void encode(std::vector<uint8_t> &result) override;
+};
+
+// One node of a sampled call tree: the frame key, resolved through the python
+// tracer hash data, and the samples whose innermost frame was this node.
+struct PythonSampleNode {
+    uint64_t thread_id{0};
+    uint64_t key{0};
+    uint64_t count{0};
+    uint32_t node_id{0};
+    uint32_t parent_id{0};
+};
+
+struct PythonSampleData : BaseReportData {
+    uint32_t interval_us{0};
+    std::vector<PythonSampleNode> nodes;
+    PythonSampleData(uint32_t interval_us, std::vector<PythonSampleNode> nodes)
+        : BaseReportData(0, "torch.python_sample"),
+          interval_us(interval_us),
+          nodes(std::move(nodes)) {}
+    void encode(std::vector<uint8_t> &result) override;
 };
 
 enum class ParamTensorDataType {
@@ -414,7 +483,7 @@ struct ParamTensorData : BaseReportData {
         : BaseReportData(0, "torch.param_tensor_info"),
           module_param_data(std::move(module_param_data)),
           optimizer_param_data(std::move(optimizer_param_data)) {}
-    std::vector<uint8_t> encode();
+    void encode(std::vector<uint8_t> &result) override;
 };
 } // profiler
 } // toolkit
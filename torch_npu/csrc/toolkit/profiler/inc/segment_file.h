@@ -0,0 +1,70 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace torch_npu {
+namespace toolkit {
+namespace profiler {
+// Compressed framework data file, all integers little endian:
+//   header   | magic "NPUZ" | uint16 version | uint16 codec |
+//   segments | uint32 compressed size | uint32 raw size | payload | ...
+//   index    | uint64 segment offset | uint64 raw offset | uint32 compressed size | uint32 raw size | ...
+//   trailer  | uint64 index offset | uint64 segment count | magic "NPZI" | uint32 reserved |
+// Each segment holds one dumped batch, so records never straddle segments and
+// the parser can decompress them independently. Payloads are LZ4 blocks, or the
+// raw bytes when they do not compress (compressed size == raw size). The index
+// and trailer are written on close, readers of a file without them scan the
+// segment headers up to the first empty one.
+constexpr uint32_t kSegmentFileMagic = 0x5A55504E;  // "NPUZ"
+constexpr uint32_t kSegmentIndexMagic = 0x495A504E; // "NPZI"
+constexpr uint16_t kSegmentFileVersion = 1;
+constexpr uint16_t kSegmentCodecLz4 = 1;
+constexpr size_t kSegmentFileHeaderSize = 8;
+constexpr size_t kSegmentHeaderSize = 8;
+constexpr size_t kSegmentIndexEntrySize = 24;
+constexpr size_t kSegmentTrailerSize = 24;
+
+// Appends the LZ4 block encoding of src to dst and returns the number of bytes appended.
+size_t Lz4CompressBlock(const uint8_t *src, size_t size, std::vector<uint8_t> &dst);
+// Decodes an LZ4 block that must expand to exactly dstSize bytes.
+bool Lz4DecompressBlock(const uint8_t *src, size_t size, uint8_t *dst, size_t dstSize);
+
+// Writer of one compressed data file. The file is written through a shared
+// mapping of a preallocated window, so segments are copied straight into the
+// page cache; if the space cannot be reserved it falls back to pwrite.
+class SegmentFile {
+public:
+    SegmentFile() = default;
+    ~SegmentFile();
+    SegmentFile(const SegmentFile &) = delete;
+    SegmentFile &operator=(const SegmentFile &) = delete;
+
+    bool Open(const std::string &path);
+    bool Append(const std::vector<uint8_t> &data);
+    void Close();
+
+private:
+    struct IndexEntry {
+        uint64_t offset;
+        uint64_t raw_offset;
+        uint32_t compressed_size;
+        uint32_t raw_size;
+    };
+
+    bool Write(const uint8_t *data, size_t size);
+    bool MapWindow(uint64_t offset);
+    void UnmapWindow();
+
+    int fd_{-1};
+    bool use_mmap_{true};
+    uint8_t *window_{nullptr};
+    uint64_t window_offset_{0};
+    uint64_t size_{0};
+    uint64_t raw_size_{0};
+    std::vector<uint8_t> segment_buf_;
+    std::vector<IndexEntry> index_;
+};
+} // profiler
+} // toolkit
+} // torch_npu
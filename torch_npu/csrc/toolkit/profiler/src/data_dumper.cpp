@@ -1,8 +1,11 @@
 #include <unistd.h>
 
+#include <algorithm>
 #include <vector>
 #include <map>
 #include <fstream>
+#include <iterator>
+#include <thread>
 #include <sys/types.h>
 #include <sys/stat.h>
 
@@ -13,8 +16,72 @@
 namespace torch_npu {
 namespace toolkit {
 namespace profiler {
+namespace {
+void DumpSegment(std::map<std::string, std::unique_ptr<SegmentFile>> &segmentMap, const std::string &dumpFile,
+                 const std::vector<uint8_t> &data)
+{
+    auto iter = segmentMap.find(dumpFile);
+    if (iter == segmentMap.end()) {
+        auto file = std::make_unique<SegmentFile>();
+        if (!file->Open(dumpFile)) {
+            return;
+        }
+        iter = segmentMap.emplace(dumpFile, std::move(file)).first;
+    }
+    iter->second->Append(data);
+}
+
+std::atomic<uint64_t> next_dumper_id{0};
+
+// The producers this thread is bound to, per dumper. They are released when
+// the thread exits, and the next new thread takes them over.
+struct ThreadProducers {
+    std::vector<std::pair<uint64_t, std::shared_ptr<ChunkProducer>>> bindings;
+
+    ~ThreadProducers()
+    {
+        for (auto &binding : bindings) {
+            binding.second->bound.store(false);
+        }
+    }
+};
+} // namespace
+
+void DumpNotifier::Init(size_t minWatermark, size_t capacity)
+{
+    min_watermark_ = std::max<size_t>(minWatermark, 1);
+    max_watermark_ = std::max(min_watermark_, capacity / 4);
+    watermark_.store(min_watermark_, std::memory_order_relaxed);
+    pending_.store(false);
+}
+
+void DumpNotifier::Notify()
+{
+    // Taking the lock orders the notification after a concurrent Wait has
+    // checked pending_, so the wakeup cannot be lost.
+    std::lock_guard<std::mutex> lock(mutex_);
+    cv_.notify_one();
+}
+
+void DumpNotifier::Wake()
+{
+    pending_.store(true);
+    Notify();
+}
+
+bool DumpNotifier::Wait(std::chrono::milliseconds timeout)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    bool woken = cv_.wait_for(lock, timeout, [this] { return pending_.load(); });
+    pending_.store(false);
+    size_t watermark = watermark_.load(std::memory_order_relaxed);
+    watermark_.store(woken ? std::min(watermark * 2, max_watermark_) : min_watermark_, std::memory_order_relaxed);
+    return woken;
+}
+
 DataDumper::DataDumper()
-    : path_(""),
+    : id_(next_dumper_id.fetch_add(1)),
+      path_(""),
       start_(false),
       init_(false) {}
 
@@ -22,9 +89,21 @@ DataDumper::~DataDumper() {
   UnInit();
 }
 
-void DataDumper::Init(const std::string &path, size_t capacity = kDefaultRingBuffer) {
+void DataDumper::Init(const std::string &path, size_t capacity = kDefaultRingBuffer, bool compress,
+                      bool shareChunks) {
   path_ = path;
+  compress_ = compress;
+  share_chunks_ = shareChunks;
+  if (share_chunks_ && shared_producer_ == nullptr) {
+    shared_producer_ = std::make_shared<ChunkProducer>();
+    shared_producer_->bound.store(true);
+    std::lock_guard<std::mutex> lock(producers_mutex_);
+    producers_.push_back(shared_producer_);
+  }
   data_chunk_buf_.Init(capacity);
+  // Every chunk is already a batch of records.
+  notifier_.Init(1, capacity);
+  dropped_.store(0);
   init_.store(true);
 }
 
@@ -41,68 +120,172 @@ void DataDumper::UnInit()
             }
         }
         fd_map_.clear();
+        segment_map_.clear();
     }
 }
 
 void DataDumper::Start() {
-    if (!init_.load() || Thread::Start() != 0) {
+    if (!init_.load()) {
         return;
     }
+    // Set before the thread runs, which exits as soon as it sees it cleared.
     start_.store(true);
+    if (Thread::Start() != 0) {
+        start_.store(false);
+    }
 }
 
 void DataDumper::Stop() {
   if (start_.load() == true) {
     start_.store(false);
+    notifier_.Wake();
     Thread::Stop();
   }
   Flush();
+  auto dropped = dropped_.load();
+  if (dropped > 0) {
+    ASCEND_LOGW("DataDumper dropped %lu records because the ring buffer was full.", dropped);
+  }
 }
 
-void DataDumper::GatherAndDumpData() {
-    std::map<std::string, std::vector<uint8_t>> dataMap;
-    uint64_t batchSize = 0;
-    while (batchSize < kBatchMaxLen) {
-        std::unique_ptr<BaseReportData> data = nullptr;
-        if (!data_chunk_buf_.Pop(data) || data == nullptr) {
-            break;
+ChunkProducer &DataDumper::GetProducer()
+{
+    if (share_chunks_) {
+        return *shared_producer_;
+    }
+    thread_local ThreadProducers local;
+    for (auto &binding : local.bindings) {
+        if (binding.first == id_) {
+            return *binding.second;
+        }
+    }
+    std::shared_ptr<ChunkProducer> producer = nullptr;
+    {
+        // Producers of exited threads are taken over with their open chunks.
+        std::lock_guard<std::mutex> lock(producers_mutex_);
+        for (auto &candidate : producers_) {
+            bool bound = false;
+            if (candidate->bound.compare_exchange_strong(bound, true)) {
+                producer = candidate;
+                break;
+            }
         }
-        std::vector<uint8_t> encodeData = data->encode();
-        batchSize += encodeData.size();
-        const std::string &key = data->tag;
-        auto iter = dataMap.find(key);
-        if (iter == dataMap.end()) {
-            dataMap.insert({key, encodeData});
-        } else {
-            iter->second.insert(iter->second.end(), encodeData.cbegin(), encodeData.cend());
+        if (producer == nullptr) {
+            producer = std::make_shared<ChunkProducer>();
+            producer->bound.store(true);
+            producers_.push_back(producer);
         }
     }
-    if (dataMap.size() > 0) {
-        static bool create_flag = true;
-        if (create_flag) {
-            create_flag = !Utils::CreateDir(this->path_);
+    local.bindings.emplace_back(id_, producer);
+    return *producer;
+}
+
+std::unique_ptr<ReportChunk> DataDumper::AcquireChunk(const std::string &tag)
+{
+    std::unique_ptr<ReportChunk> chunk = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(free_mutex_);
+        if (!free_chunks_.empty()) {
+            chunk = std::move(free_chunks_.back());
+            free_chunks_.pop_back();
         }
-        Dump(dataMap);
     }
+    if (chunk == nullptr) {
+        chunk = std::make_unique<ReportChunk>();
+        chunk->data.reserve(kReportChunkSize);
+    }
+    chunk->tag = tag;
+    return chunk;
 }
 
-void DataDumper::Run() {
-    for (;;) {
-        if (!start_.load()) {
+void DataDumper::RecycleChunk(std::unique_ptr<ReportChunk> chunk)
+{
+    chunk->data.clear();
+    chunk->records = 0;
+    if (chunk->data.capacity() > kReportChunkSize) {
+        // Grown by an oversized record.
+        std::vector<uint8_t>().swap(chunk->data);
+        chunk->data.reserve(kReportChunkSize);
+    }
+    std::lock_guard<std::mutex> lock(free_mutex_);
+    free_chunks_.push_back(std::move(chunk));
+}
+
+void DataDumper::HandOff(std::unique_ptr<ReportChunk> chunk)
+{
+    const uint64_t records = chunk->records;
+    if (C10_UNLIKELY(!data_chunk_buf_.Push(std::move(chunk)))) {
+        dropped_.fetch_add(records, std::memory_order_relaxed);
+        notifier_.Wake();
+        return;
+    }
+    notifier_.OnPush(data_chunk_buf_.Size());
+}
+
+void DataDumper::SealChunks()
+{
+    // Hands over the open chunks of all producers, so the records of threads
+    // that went quiet are written too. Each producer's chunks stay in order.
+    std::vector<std::shared_ptr<ChunkProducer>> producers;
+    {
+        std::lock_guard<std::mutex> lock(producers_mutex_);
+        producers = producers_;
+    }
+    for (auto &producer : producers) {
+        std::lock_guard<std::mutex> lock(producer->mutex);
+        for (auto &chunk : producer->chunks) {
+            HandOff(std::move(chunk));
+        }
+        producer->chunks.clear();
+    }
+}
+
+bool DataDumper::GatherAndDumpData() {
+    uint64_t batchSize = 0;
+    bool popped = false;
+    while (batchSize < kBatchMaxLen) {
+        std::unique_ptr<ReportChunk> chunk = nullptr;
+        if (!data_chunk_buf_.Pop(chunk) || chunk == nullptr) {
             break;
         }
-        if (data_chunk_buf_.Size() > kNotifyInterval) {
-            GatherAndDumpData();
-        } else {
-            usleep(kMaxWaitTimeUs);
+        popped = true;
+        if (!chunk->data.empty()) {
+            static bool create_flag = true;
+            if (create_flag) {
+                create_flag = !Utils::CreateDir(this->path_);
+            }
+            Dump(chunk->tag, chunk->data);
+            batchSize += chunk->data.size();
+        }
+        RecycleChunk(std::move(chunk));
+    }
+    return popped;
+}
+
+void DataDumper::Run() {
+    auto lastSeal = std::chrono::steady_clock::now();
+    while (start_.load()) {
+        // Woken by producers at the watermark, otherwise flush what has
+        // accumulated after kMaxWaitTimeMs.
+        notifier_.Wait(std::chrono::milliseconds(kMaxWaitTimeMs));
+        auto now = std::chrono::steady_clock::now();
+        if (now - lastSeal >= std::chrono::milliseconds(kMaxWaitTimeMs)) {
+            SealChunks();
+            lastSeal = now;
         }
+        // Stops at a slot that is claimed but not filled yet instead of
+        // spinning on it, the next wakeup picks it up.
+        while (GatherAndDumpData()) {}
     }
 }
 
 void DataDumper::Flush() {
-  while (data_chunk_buf_.Size() != 0) {
-    GatherAndDumpData();
-  }
+  // Empties the ring first, so that sealing the open chunks cannot drop them.
+  // Sealing takes every producer lock, after it no push is in flight and
+  // every claimed slot is filled.
+  while (GatherAndDumpData()) {}
+  SealChunks();
+  while (GatherAndDumpData()) {}
 }
 
 void DataDumper::Report(std::unique_ptr<BaseReportData> data)
@@ -110,31 +293,58 @@ void DataDumper::Report(std::unique_ptr<BaseReportData> data)
     if (C10_UNLIKELY(!start_.load() || data == nullptr)) {
         return;
     }
-    data_chunk_buf_.Push(std::move(data));
+    ChunkProducer &producer = GetProducer();
+    std::lock_guard<std::mutex> lock(producer.mutex);
+    // Checked again under the lock: once Stop has sealed this producer, no
+    // record may be left in an open chunk.
+    if (C10_UNLIKELY(!start_.load())) {
+        return;
+    }
+    auto iter = std::find_if(producer.chunks.begin(), producer.chunks.end(),
+                             [&data](const std::unique_ptr<ReportChunk> &chunk) { return chunk->tag == data->tag; });
+    if (iter == producer.chunks.end()) {
+        producer.chunks.push_back(AcquireChunk(data->tag));
+        iter = std::prev(producer.chunks.end());
+    }
+    ReportChunk &chunk = **iter;
+    data->encode(chunk.data);
+    chunk.records++;
+    if (chunk.data.size() + kReportChunkHeadroom > kReportChunkSize) {
+        std::unique_ptr<ReportChunk> full = std::move(*iter);
+        producer.chunks.erase(iter);
+        HandOff(std::move(full));
+    }
 }
 
-void DataDumper::Dump(const std::map<std::string, std::vector<uint8_t>> &dataMap)
+uint64_t DataDumper::GetDroppedCount() const
 {
-    for (auto &data : dataMap) {
-        FILE *fd = nullptr;
-        const std::string dump_file = path_ + "/" + data.first;
-        auto iter = fd_map_.find(dump_file);
-        if (iter == fd_map_.end()) {
-            if (!Utils::IsFileExist(dump_file) && !Utils::CreateFile(dump_file)) {
-                ASCEND_LOGE("DataDumper cerate file failed: %s", dump_file.c_str());
-                continue;
-            }
-            fd = fopen(dump_file.c_str(), "ab");
-            if (fd == nullptr) {
-                ASCEND_LOGE("DataDumper open file failed: %s", dump_file.c_str());
-                continue;
-            }
-            fd_map_.insert({dump_file, fd});
-        } else {
-            fd = iter->second;
+    return dropped_.load();
+}
+
+void DataDumper::Dump(const std::string &tag, const std::vector<uint8_t> &data)
+{
+    const std::string dump_file = path_ + "/" + tag;
+    if (compress_) {
+        DumpSegment(segment_map_, dump_file, data);
+        return;
+    }
+    FILE *fd = nullptr;
+    auto iter = fd_map_.find(dump_file);
+    if (iter == fd_map_.end()) {
+        if (!Utils::IsFileExist(dump_file) && !Utils::CreateFile(dump_file)) {
+            ASCEND_LOGE("DataDumper cerate file failed: %s", dump_file.c_str());
+            return;
         }
-        fwrite(reinterpret_cast<const char*>(data.second.data()), sizeof(char), data.second.size(), fd);
+        fd = fopen(dump_file.c_str(), "ab");
+        if (fd == nullptr) {
+            ASCEND_LOGE("DataDumper open file failed: %s", dump_file.c_str());
+            return;
+        }
+        fd_map_.insert({dump_file, fd});
+    } else {
+        fd = iter->second;
     }
+    fwrite(reinterpret_cast<const char*>(data.data()), sizeof(char), data.size(), fd);
 }
 
 TraceDataDumper::TraceDataDumper()
@@ -148,10 +358,14 @@ TraceDataDumper::~TraceDataDumper()
     UnInit();
 }
 
-void TraceDataDumper::Init(const std::string &path, size_t capacity)
+void TraceDataDumper::Init(const std::string &path, size_t capacity, bool compress)
 {
     path_ = path;
+    compress_ = compress;
     trace_data_buf_.Init(capacity);
+    // Every record is already a batch of python events, dump them right away.
+    notifier_.Init(1, capacity);
+    dropped_.store(0);
     init_.store(true);
 }
 
@@ -159,6 +373,7 @@ void TraceDataDumper::UnInit()
 {
     if (init_.load()) {
         trace_data_buf_.UnInit();
+        std::vector<uint8_t>().swap(encode_buf_);
         init_.store(false);
         start_.store(false);
         for (auto &f : fd_map_) {
@@ -168,41 +383,48 @@ void TraceDataDumper::UnInit()
             }
         }
         fd_map_.clear();
+        segment_map_.clear();
     }
 }
 
 void TraceDataDumper::Start()
 {
-    if (!init_.load() || Thread::Start() != 0) {
+    if (!init_.load()) {
         return;
     }
     start_.store(true);
+    if (Thread::Start() != 0) {
+        start_.store(false);
+    }
 }
 
 void TraceDataDumper::Stop()
 {
     if (start_.load() == true) {
         start_.store(false);
+        notifier_.Wake();
         Thread::Stop();
     }
+    auto dropped = dropped_.load();
+    if (dropped > 0) {
+        ASCEND_LOGW("TraceDataDumper dropped %lu records because the ring buffer was full.", dropped);
+    }
+    // A producer that saw start_ set may still be filling its slot.
     while (trace_data_buf_.Size() != 0) {
-        FlushTraceData();
+        if (!FlushTraceData()) {
+            std::this_thread::yield();
+        }
     }
     FlushHashData();
     FlushParamData();
+    FlushSampleData();
 }
 
 void TraceDataDumper::Run()
 {
-    while (true) {
-        if (!start_.load()) {
-            break;
-        }
-        if (trace_data_buf_.Size() > 0) {
-            FlushTraceData();
-        } else {
-            usleep(kMaxWaitTimeUs);
-        }
+    while (start_.load()) {
+        notifier_.Wait(std::chrono::milliseconds(kMaxWaitTimeMs));
+        while (FlushTraceData()) {}
     }
 }
 
@@ -211,7 +433,17 @@ void TraceDataDumper::Report(std::unique_ptr<PythonTracerFuncData> data)
     if (C10_UNLIKELY(!start_.load() || data == nullptr)) {
         return;
     }
-    trace_data_buf_.Push(std::move(data));
+    if (C10_UNLIKELY(!trace_data_buf_.Push(std::move(data)))) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        notifier_.Wake();
+        return;
+    }
+    notifier_.OnPush(trace_data_buf_.Size());
+}
+
+uint64_t TraceDataDumper::GetDroppedCount() const
+{
+    return dropped_.load();
 }
 
 void TraceDataDumper::ReportHash(std::unique_ptr<PythonTracerHashData> data)
@@ -230,6 +462,14 @@ void TraceDataDumper::ReportParam(std::unique_ptr<ParamTensorData> data)
     param_data_ = std::move(data);
 }
 
+void TraceDataDumper::ReportSample(std::unique_ptr<PythonSampleData> data)
+{
+    if (C10_UNLIKELY(!start_.load() || data == nullptr)) {
+        return;
+    }
+    sample_data_ = std::move(data);
+}
+
 void TraceDataDumper::CreateDumpDir()
 {
     static bool create_flag = true;
@@ -238,17 +478,19 @@ void TraceDataDumper::CreateDumpDir()
     }
 }
 
-void TraceDataDumper::FlushTraceData()
+bool TraceDataDumper::FlushTraceData()
 {
     std::unique_ptr<PythonTracerFuncData> data = nullptr;
     if (!trace_data_buf_.Pop(data) || data == nullptr) {
-        return;
+        return false;
     }
-    auto encode_data = data->encode();
-    if (!encode_data.empty()) {
+    encode_buf_.clear();
+    data->encode(encode_buf_);
+    if (!encode_buf_.empty()) {
         CreateDumpDir();
-        Dump(data->tag, encode_data);
+        Dump(data->tag, encode_buf_);
     }
+    return true;
 }
 
 void TraceDataDumper::FlushHashData()
@@ -256,10 +498,11 @@ void TraceDataDumper::FlushHashData()
     if (trace_hash_data_ == nullptr) {
         return;
     }
-    auto encode_data = trace_hash_data_->encode();
-    if (!encode_data.empty()) {
+    encode_buf_.clear();
+    trace_hash_data_->encode(encode_buf_);
+    if (!encode_buf_.empty()) {
         CreateDumpDir();
-        Dump(trace_hash_data_->tag, encode_data);
+        Dump(trace_hash_data_->tag, encode_buf_);
     }
     trace_hash_data_ = nullptr;
 }
@@ -269,18 +512,37 @@ void TraceDataDumper::FlushParamData()
     if (param_data_ == nullptr) {
         return;
     }
-    auto encode_data = param_data_->encode();
-    if (!encode_data.empty()) {
+    encode_buf_.clear();
+    param_data_->encode(encode_buf_);
+    if (!encode_buf_.empty()) {
         CreateDumpDir();
-        Dump(param_data_->tag, encode_data);
+        Dump(param_data_->tag, encode_buf_);
     }
     param_data_ = nullptr;
 }
 
+void TraceDataDumper::FlushSampleData()
+{
+    if (sample_data_ == nullptr) {
+        return;
+    }
+    encode_buf_.clear();
+    sample_data_->encode(encode_buf_);
+    if (!encode_buf_.empty()) {
+        CreateDumpDir();
+        Dump(sample_data_->tag, encode_buf_);
+    }
+    sample_data_ = nullptr;
+}
+
 void TraceDataDumper::Dump(const std::string& file_name, const std::vector<uint8_t>& encode_data)
 {
-    FILE *fd = nullptr;
     const std::string dump_file = path_ + "/" + file_name;
+    if (compress_) {
+        DumpSegment(segment_map_, dump_file, encode_data);
+        return;
+    }
+    FILE *fd = nullptr;
     auto iter = fd_map_.find(dump_file);
     if (iter == fd_map_.end()) {
         if (!Utils::IsFileExist(dump_file) && !Utils::CreateFile(dump_file)) {
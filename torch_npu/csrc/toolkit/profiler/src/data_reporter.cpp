@@ -20,9 +20,9 @@ TensorMetadata::TensorMetadata(const at::Tensor &t)
     }
 }
 
-std::vector<uint8_t> OpRangeData::encode()
+void OpRangeData::encode(std::vector<uint8_t> &result)
 {
-    std::vector<uint8_t> result;
+    size_t offset = encodeTLVBegin(static_cast<uint16_t>(FwkDataType::OP_RANGE_DATA), result);
     encodeFixedData<int64_t>({start_ns, end_ns, sequence_number}, result);
     encodeFixedData<uint64_t>({process_id, start_thread_id, end_thread_id, forward_thread_id}, result);
     encodeFixedData<uint8_t>({scope}, result);
@@ -52,134 +52,93 @@ std::vector<uint8_t> OpRangeData::encode()
     if (!extra_args.empty()) {
         encodeMapData(static_cast<uint16_t>(OpRangeDataType::EXTRA_ARGS), extra_args, result);
     }
-
-    std::vector<uint8_t> resultTLV;
-    uint16_t dataType = static_cast<uint16_t>(FwkDataType::OP_RANGE_DATA);
-    for (size_t i = 0; i < sizeof(uint16_t); ++i) {
-        resultTLV.push_back((dataType >> (i * 8)) & 0xff);
-    }
-    uint32_t length = result.size();
-    for (size_t i = 0; i < sizeof(uint32_t); ++i) {
-        resultTLV.push_back((length >> (i * 8)) & 0xff);
-    }
-    resultTLV.insert(resultTLV.end(), result.cbegin(), result.cend());
-    return resultTLV;
+    encodeTLVEnd(offset, result);
 }
 
-std::vector<uint8_t> OpMarkData::encode()
+void OpMarkData::encode(std::vector<uint8_t> &result)
 {
-    std::vector<uint8_t> result;
+    size_t offset = encodeTLVBegin(static_cast<uint16_t>(FwkDataType::OP_MARK_DATA), result);
     encodeFixedData<int64_t>({time_ns}, result);
     encodeFixedData<uint64_t>({category, correlation_id, thread_id, process_id}, result);
     encodeStrData(static_cast<uint16_t>(OpMarkDataType::NAME), name, result);
-
-    std::vector<uint8_t> resultTLV;
-    uint16_t dataType = static_cast<uint16_t>(FwkDataType::OP_MARK_DATA);
-    for (size_t i = 0; i < sizeof(uint16_t); ++i) {
-        resultTLV.push_back((dataType >> (i * 8)) & 0xff);
-    }
-    uint32_t length = result.size();
-    for (size_t i = 0; i < sizeof(uint32_t); ++i) {
-        resultTLV.push_back((length >> (i * 8)) & 0xff);
-    }
-    resultTLV.insert(resultTLV.end(), result.cbegin(), result.cend());
-    return resultTLV;
+    encodeTLVEnd(offset, result);
 }
 
-std::vector<uint8_t> MemoryData::encode()
+void MemoryData::encode(std::vector<uint8_t> &result)
 {
-    std::vector<uint8_t> result;
+    size_t offset = encodeTLVBegin(static_cast<uint16_t>(FwkDataType::MEMORY_DATA), result);
     encodeFixedData<int64_t>({ptr, time_ns, alloc_size, total_allocated,
                               total_reserved, total_active, stream_ptr},
                              result);
     encodeFixedData<int8_t>({device_type, device_index}, result);
     encodeFixedData<uint8_t>({data_type, allocator_type}, result);
     encodeFixedData<uint64_t>({thread_id, process_id}, result);
+    encodeTLVEnd(offset, result);
+}
 
-    std::vector<uint8_t> resultTLV;
-    uint16_t dataType = static_cast<uint16_t>(FwkDataType::MEMORY_DATA);
-    for (size_t i = 0; i < sizeof(uint16_t); ++i) {
-        resultTLV.push_back((dataType >> (i * 8)) & 0xff);
-    }
-    uint32_t length = result.size();
-    for (size_t i = 0; i < sizeof(uint32_t); ++i) {
-        resultTLV.push_back((length >> (i * 8)) & 0xff);
+void MemoryAggregateData::encode(std::vector<uint8_t> &result)
+{
+    // Fixed size records without TLV header, in MemoryAggregateRecord field order.
+    constexpr size_t kRecordSize = 15 * sizeof(int64_t) + 3 * sizeof(int8_t);
+    result.reserve(result.size() + records.size() * kRecordSize);
+    for (const auto& item : records) {
+        encodeFixedData<int64_t>({item.start_ns, item.end_ns, item.peak_ns, item.stream_ptr,
+                                  item.alloc_bytes, item.free_bytes}, result);
+        encodeFixedData<uint64_t>({item.alloc_count, item.free_count}, result);
+        encodeFixedData<int64_t>({item.peak_allocated, item.peak_reserved, item.peak_active,
+                                  item.total_allocated, item.total_reserved, item.total_active}, result);
+        encodeFixedData<uint64_t>({item.process_id}, result);
+        encodeFixedData<int8_t>({item.device_type, item.device_index}, result);
+        encodeFixedData<uint8_t>({item.allocator_type}, result);
     }
-    resultTLV.insert(resultTLV.end(), result.cbegin(), result.cend());
-    return resultTLV;
 }
 
-std::vector<uint8_t> PythonTracerFuncData::encode()
+void PythonTracerFuncData::encode(std::vector<uint8_t> &result)
 {
-    std::vector<uint8_t> result;
+    // Fixed size records without TLV header: ts, tid, pid, key and tag.
+    constexpr size_t kEventSize = 4 * sizeof(uint64_t) + sizeof(uint8_t);
+    result.reserve(result.size() + events.size() * kEventSize);
     for (const auto& item : events) {
         encodeFixedData<uint64_t>({item.ts_, item.tid_, process_id, item.key_}, result);
         encodeFixedData<uint8_t>({item.tag_}, result);
     }
-    return result;
 }
 
-std::vector<uint8_t> PythonTracerHashData::encode()
+void PythonTracerHashData::encode(std::vector<uint8_t> &result)
 {
-    std::vector<uint8_t> result;
     for (const auto& item : hash_data) {
-        std::vector<uint8_t> item_data;
-        encodeFixedData<uint64_t>({item.first}, item_data);
-        encodeStrData(static_cast<uint16_t>(PythonTracerHashDataType::VALUE), item.second, item_data);
+        size_t offset = encodeTLVBegin(static_cast<uint16_t>(FwkDataType::PYTHON_TRACER_HASH_DATA), result);
+        encodeFixedData<uint64_t>({item.first}, result);
+        encodeStrData(static_cast<uint16_t>(PythonTracerHashDataType::VALUE), item.second, result);
+        encodeTLVEnd(offset, result);
+    }
+}
 
-        std::vector<uint8_t> tlv_data;
-        uint16_t dataType = static_cast<uint16_t>(FwkDataType::PYTHON_TRACER_HASH_DATA);
-        for (size_t i = 0; i < sizeof(uint16_t); ++i) {
-            tlv_data.push_back((dataType >> (i * 8)) & 0xff);
-        }
-        uint32_t length = item_data.size();
-        for (size_t i = 0; i < sizeof(uint32_t); ++i) {
-            tlv_data.push_back((length >> (i * 8)) & 0xff);
-        }
-        tlv_data.insert(tlv_data.end(), item_data.cbegin(), item_data.cend());
-        result.insert(result.end(), tlv_data.cbegin(), tlv_data.cend());
+void PythonSampleData::encode(std::vector<uint8_t> &result)
+{
+    // Fixed size records without TLV header: thread id, key, count, node id, parent id and interval.
+    constexpr size_t kNodeSize = 3 * sizeof(uint64_t) + 3 * sizeof(uint32_t);
+    result.reserve(result.size() + nodes.size() * kNodeSize);
+    for (const auto& node : nodes) {
+        encodeFixedData<uint64_t>({node.thread_id, node.key, node.count}, result);
+        encodeFixedData<uint32_t>({node.node_id, node.parent_id, interval_us}, result);
     }
-    return result;
 }
 
-std::vector<uint8_t> ParamTensorData::encode()
+void ParamTensorData::encode(std::vector<uint8_t> &result)
 {
-    std::vector<uint8_t> result;
     for (const auto& item : module_param_data) {
-        std::vector<uint8_t> item_data;
-        encodeFixedData<uint64_t>({item.first}, item_data);
-        encodeModuleParams(static_cast<uint16_t>(ParamTensorDataType::MODULE_PARAM), item.second, item_data);
-
-        std::vector<uint8_t> tlv_data;
-        uint16_t dataType = static_cast<uint16_t>(FwkDataType::PARAM_TENSOR_DATA);
-        for (size_t i = 0; i < sizeof(uint16_t); ++i) {
-            tlv_data.push_back((dataType >> (i * 8)) & 0xff);
-        }
-        uint32_t length = item_data.size();
-        for (size_t i = 0; i < sizeof(uint32_t); ++i) {
-            tlv_data.push_back((length >> (i * 8)) & 0xff);
-        }
-        tlv_data.insert(tlv_data.end(), item_data.cbegin(), item_data.cend());
-        result.insert(result.end(), tlv_data.cbegin(), tlv_data.cend());
+        size_t offset = encodeTLVBegin(static_cast<uint16_t>(FwkDataType::PARAM_TENSOR_DATA), result);
+        encodeFixedData<uint64_t>({item.first}, result);
+        encodeModuleParams(static_cast<uint16_t>(ParamTensorDataType::MODULE_PARAM), item.second, result);
+        encodeTLVEnd(offset, result);
     }
     for (const auto& item : optimizer_param_data) {
-        std::vector<uint8_t> item_data;
-        encodeFixedData<uint64_t>({item.first}, item_data);
-        encodeOptimizerParams(static_cast<uint16_t>(ParamTensorDataType::OPTIMIZER_PARAM), item.second, item_data);
-
-        std::vector<uint8_t> tlv_data;
-        uint16_t dataType = static_cast<uint16_t>(FwkDataType::PARAM_TENSOR_DATA);
-        for (size_t i = 0; i < sizeof(uint16_t); ++i) {
-            tlv_data.push_back((dataType >> (i * 8)) & 0xff);
-        }
-        uint32_t length = item_data.size();
-        for (size_t i = 0; i < sizeof(uint32_t); ++i) {
-            tlv_data.push_back((length >> (i * 8)) & 0xff);
-        }
-        tlv_data.insert(tlv_data.end(), item_data.cbegin(), item_data.cend());
-        result.insert(result.end(), tlv_data.cbegin(), tlv_data.cend());
+        size_t offset = encodeTLVBegin(static_cast<uint16_t>(FwkDataType::PARAM_TENSOR_DATA), result);
+        encodeFixedData<uint64_t>({item.first}, result);
+        encodeOptimizerParams(static_cast<uint16_t>(ParamTensorDataType::OPTIMIZER_PARAM), item.second, result);
+        encodeTLVEnd(offset, result);
     }
-    return result;
 }
 } // profiler
 } // toolkit
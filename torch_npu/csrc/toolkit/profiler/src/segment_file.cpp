@@ -0,0 +1,301 @@
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+
+#include "torch_npu/csrc/toolkit/profiler/inc/segment_file.h"
+#include "torch_npu/csrc/core/npu/npu_log.h"
+
+namespace torch_npu {
+namespace toolkit {
+namespace profiler {
+namespace {
+constexpr uint32_t kHashLog = 14;
+constexpr size_t kMinMatch = 4;
+constexpr size_t kLastLiterals = 5;     // LZ4 blocks end with at least 5 literals
+constexpr size_t kMatchFindLimit = 12;  // and the last match starts 12 bytes before the end
+constexpr size_t kMaxOffset = 65535;
+constexpr uint64_t kMapWindowSize = 64 * 1024 * 1024;
+
+inline uint32_t Read32(const uint8_t *p)
+{
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline uint32_t Hash(uint32_t sequence)
+{
+    return (sequence * 2654435761U) >> (32 - kHashLog);
+}
+
+inline void PutLength(size_t length, std::vector<uint8_t> &dst)
+{
+    for (; length >= 255; length -= 255) {
+        dst.push_back(255);
+    }
+    dst.push_back(static_cast<uint8_t>(length));
+}
+
+void PutSequence(const uint8_t *literals, size_t literalLen, size_t offset, size_t matchLen,
+                 std::vector<uint8_t> &dst)
+{
+    size_t matchCode = matchLen == 0 ? 0 : matchLen - kMinMatch;
+    dst.push_back(static_cast<uint8_t>((std::min<size_t>(literalLen, 15) << 4) | std::min<size_t>(matchCode, 15)));
+    if (literalLen >= 15) {
+        PutLength(literalLen - 15, dst);
+    }
+    dst.insert(dst.end(), literals, literals + literalLen);
+    if (matchLen == 0) {
+        return;
+    }
+    dst.push_back(static_cast<uint8_t>(offset & 0xff));
+    dst.push_back(static_cast<uint8_t>(offset >> 8));
+    if (matchCode >= 15) {
+        PutLength(matchCode - 15, dst);
+    }
+}
+
+template <typename T>
+inline void PutLE(T value, uint8_t *dst)
+{
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        dst[i] = static_cast<uint8_t>(value >> (i * 8));
+    }
+}
+} // namespace
+
+size_t Lz4CompressBlock(const uint8_t *src, size_t size, std::vector<uint8_t> &dst)
+{
+    const size_t start = dst.size();
+    size_t anchor = 0;
+    if (size > kMatchFindLimit) {
+        std::vector<uint32_t> table(1U << kHashLog, 0);
+        const size_t matchFindLimit = size - kMatchFindLimit;
+        const size_t matchLimit = size - kLastLiterals;
+        size_t pos = 0;
+        while (pos <= matchFindLimit) {
+            uint32_t sequence = Read32(src + pos);
+            uint32_t &slot = table[Hash(sequence)];
+            size_t ref = slot;
+            slot = static_cast<uint32_t>(pos);
+            if (ref >= pos || pos - ref > kMaxOffset || Read32(src + ref) != sequence) {
+                // Skip faster through data that does not compress.
+                pos += 1 + ((pos - anchor) >> 6);
+                continue;
+            }
+            while (pos > anchor && ref > 0 && src[pos - 1] == src[ref - 1]) {
+                --pos;
+                --ref;
+            }
+            size_t matchLen = kMinMatch;
+            while (pos + matchLen < matchLimit && src[ref + matchLen] == src[pos + matchLen]) {
+                ++matchLen;
+            }
+            PutSequence(src + anchor, pos - anchor, pos - ref, matchLen, dst);
+            pos += matchLen;
+            anchor = pos;
+        }
+    }
+    PutSequence(src + anchor, size - anchor, 0, 0, dst);
+    return dst.size() - start;
+}
+
+bool Lz4DecompressBlock(const uint8_t *src, size_t size, uint8_t *dst, size_t dstSize)
+{
+    size_t in = 0;
+    size_t out = 0;
+    auto readLength = [&](size_t &length) {
+        uint8_t byte = 0;
+        do {
+            if (in >= size) {
+                return false;
+            }
+            byte = src[in++];
+            length += byte;
+        } while (byte == 255);
+        return true;
+    };
+    while (in < size) {
+        uint8_t token = src[in++];
+        size_t literalLen = token >> 4;
+        if (literalLen == 15 && !readLength(literalLen)) {
+            return false;
+        }
+        if (literalLen > size - in || literalLen > dstSize - out) {
+            return false;
+        }
+        if (literalLen > 0) {
+            memcpy(dst + out, src + in, literalLen);
+        }
+        in += literalLen;
+        out += literalLen;
+        if (in == size) {
+            break;
+        }
+        if (size - in < 2) {
+            return false;
+        }
+        size_t offset = src[in] | (static_cast<size_t>(src[in + 1]) << 8);
+        in += 2;
+        size_t matchLen = token & 0xf;
+        if (matchLen == 15 && !readLength(matchLen)) {
+            return false;
+        }
+        matchLen += kMinMatch;
+        if (offset == 0 || offset > out || matchLen > dstSize - out) {
+            return false;
+        }
+        // Byte by byte, the match may overlap the bytes it produces.
+        for (size_t i = 0; i < matchLen; ++i, ++out) {
+            dst[out] = dst[out - offset];
+        }
+    }
+    return out == dstSize;
+}
+
+SegmentFile::~SegmentFile()
+{
+    Close();
+}
+
+bool SegmentFile::Open(const std::string &path)
+{
+    Close();
+    fd_ = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0640);
+    if (fd_ < 0) {
+        ASCEND_LOGE("SegmentFile open file failed: %s, errno: %d", path.c_str(), errno);
+        return false;
+    }
+    use_mmap_ = true;
+    size_ = 0;
+    raw_size_ = 0;
+    index_.clear();
+    uint8_t header[kSegmentFileHeaderSize];
+    PutLE(kSegmentFileMagic, header);
+    PutLE(kSegmentFileVersion, header + 4);
+    PutLE(kSegmentCodecLz4, header + 6);
+    return Write(header, sizeof(header));
+}
+
+bool SegmentFile::Append(const std::vector<uint8_t> &data)
+{
+    if (fd_ < 0 || data.empty()) {
+        return false;
+    }
+    if (data.size() > std::numeric_limits<uint32_t>::max()) {
+        ASCEND_LOGE("SegmentFile segment of %zu bytes is too large.", data.size());
+        return false;
+    }
+    segment_buf_.resize(kSegmentHeaderSize);
+    size_t compressed = Lz4CompressBlock(data.data(), data.size(), segment_buf_);
+    if (compressed >= data.size()) {
+        segment_buf_.resize(kSegmentHeaderSize);
+        segment_buf_.insert(segment_buf_.end(), data.cbegin(), data.cend());
+        compressed = data.size();
+    }
+    PutLE(static_cast<uint32_t>(compressed), segment_buf_.data());
+    PutLE(static_cast<uint32_t>(data.size()), segment_buf_.data() + 4);
+    IndexEntry entry{size_, raw_size_, static_cast<uint32_t>(compressed), static_cast<uint32_t>(data.size())};
+    if (!Write(segment_buf_.data(), segment_buf_.size())) {
+        return false;
+    }
+    index_.push_back(entry);
+    raw_size_ += data.size();
+    return true;
+}
+
+void SegmentFile::Close()
+{
+    if (fd_ < 0) {
+        return;
+    }
+    std::vector<uint8_t> index(index_.size() * kSegmentIndexEntrySize + kSegmentTrailerSize);
+    uint8_t *p = index.data();
+    for (const auto &entry : index_) {
+        PutLE(entry.offset, p);
+        PutLE(entry.raw_offset, p + 8);
+        PutLE(entry.compressed_size, p + 16);
+        PutLE(entry.raw_size, p + 20);
+        p += kSegmentIndexEntrySize;
+    }
+    PutLE(size_, p);
+    PutLE(static_cast<uint64_t>(index_.size()), p + 8);
+    PutLE(kSegmentIndexMagic, p + 16);
+    PutLE(static_cast<uint32_t>(0), p + 20);
+    Write(index.data(), index.size());
+    UnmapWindow();
+    // Drop the preallocated tail of the last window.
+    if (ftruncate(fd_, static_cast<off_t>(size_)) != 0) {
+        ASCEND_LOGW("SegmentFile truncate failed, errno: %d", errno);
+    }
+    close(fd_);
+    fd_ = -1;
+    index_.clear();
+    std::vector<uint8_t>().swap(segment_buf_);
+}
+
+bool SegmentFile::Write(const uint8_t *data, size_t size)
+{
+    while (size > 0) {
+        if (use_mmap_ && (window_ == nullptr || size_ >= window_offset_ + kMapWindowSize) &&
+            !MapWindow(size_ - size_ % kMapWindowSize)) {
+            use_mmap_ = false;
+        }
+        if (!use_mmap_) {
+            ssize_t written = pwrite(fd_, data, size, static_cast<off_t>(size_));
+            if (written < 0 && errno == EINTR) {
+                continue;
+            }
+            if (written <= 0) {
+                ASCEND_LOGE("SegmentFile write failed, errno: %d", errno);
+                return false;
+            }
+            data += written;
+            size -= static_cast<size_t>(written);
+            size_ += static_cast<uint64_t>(written);
+            continue;
+        }
+        size_t n = static_cast<size_t>(std::min<uint64_t>(size, window_offset_ + kMapWindowSize - size_));
+        memcpy(window_ + (size_ - window_offset_), data, n);
+        data += n;
+        size -= n;
+        size_ += n;
+    }
+    return true;
+}
+
+bool SegmentFile::MapWindow(uint64_t offset)
+{
+    UnmapWindow();
+    // Reserve the blocks up front, writing through a mapping of a sparse file
+    // would raise SIGBUS instead of an error once the disk is full.
+    int ret = posix_fallocate(fd_, static_cast<off_t>(offset), static_cast<off_t>(kMapWindowSize));
+    if (ret != 0) {
+        ASCEND_LOGW("SegmentFile preallocate failed, errno: %d, fall back to pwrite.", ret);
+        return false;
+    }
+    void *addr = mmap(nullptr, kMapWindowSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, static_cast<off_t>(offset));
+    if (addr == MAP_FAILED) {
+        ASCEND_LOGW("SegmentFile mmap failed, errno: %d, fall back to pwrite.", errno);
+        return false;
+    }
+    window_ = static_cast<uint8_t *>(addr);
+    window_offset_ = offset;
+    return true;
+}
+
+void SegmentFile::UnmapWindow()
+{
+    if (window_ != nullptr) {
+        munmap(window_, kMapWindowSize);
+        window_ = nullptr;
+    }
+}
+} // profiler
+} // toolkit
+} // torch_npu
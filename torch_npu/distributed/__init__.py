@@ -2,7 +2,8 @@ import torch_npu
 from torch_npu.utils._error_code import ErrCode, dist_error
 
 __all__ = [
-    "is_hccl_available", "reinit_process_group", "reduce_scatter_tensor_uneven", "all_gather_into_tensor_uneven"
+    "is_hccl_available", "reinit_process_group", "reduce_scatter_tensor_uneven", "all_gather_into_tensor_uneven",
+    "all_to_all_single_device_splits", "init_hccl_comms"
 ]
 
 
@@ -26,10 +27,16 @@ from torch_npu._C._distributed_c10d import (
     ParallelStore,
     _verify_params_across_processes,
     _is_support_hccl_comm_name,
+    BuiltinCommHookType,
+    _register_builtin_comm_hook,
+    _register_powersgd_comm_hook,
+    _PowerSGDState,
 )
 
 
 from torch_npu.distributed import rendezvous, fsdp, tensor
-from .distributed_c10d import is_hccl_available, reinit_process_group, _reduce_scatter_tensor_uneven as reduce_scatter_tensor_uneven, _all_gather_into_tensor_uneven as all_gather_into_tensor_uneven
+from .distributed_c10d import is_hccl_available, reinit_process_group, _reduce_scatter_tensor_uneven as reduce_scatter_tensor_uneven, _all_gather_into_tensor_uneven as all_gather_into_tensor_uneven, \
+    _all_to_all_single_device_splits as all_to_all_single_device_splits
+from .distributed_c10d import init_hccl_comms
 
 rendezvous._rendezvous_init()
@@ -10,8 +10,9 @@ from torch.distributed.distributed_c10d import _get_default_group, get_group_ran
     _get_object_coll_device, _object_to_tensor, get_world_size, _tensor_to_object, all_gather, Backend, \
     get_backend, GatherOptions, _update_default_pg, _world, _unregister_all_process_groups, _pg_map, \
     ProcessGroup, default_pg_timeout, ReduceScatterOptions, _unregister_process_group
+from torch_npu._C._distributed_c10d import _init_hccl_comms
 
-__all__ = ["is_hccl_available", "reinit_process_group"]
+__all__ = ["is_hccl_available", "reinit_process_group", "init_hccl_comms"]
 
 
 def _batch_isend_irecv(p2p_op_list):
@@ -65,7 +66,8 @@ def _gather(tensor, gather_list=None, dst=0, group=None, async_op=False):
         Async work handle, if async_op is set to True.
         None, if not async_op or if not part of the group
     Note:
-        Npu doesn't support gather currently, replaced with all_gather.
+        On npu, tensors gathered from each rank may differ in shape as long as
+        gather_list on the destination rank is sized accordingly.
     """
 
     _check_single_tensor(tensor, "tensor")
@@ -82,47 +84,17 @@ def _gather(tensor, gather_list=None, dst=0, group=None, async_op=False):
     my_rank = get_rank()
 
     _validate_output_list_for_rank(my_rank, dst, gather_list)
-    group_size = _get_group_size(group)
-    recv_size_list = [None for _ in range(group_size)] if my_rank != dst else \
-        [tensor.size() for tensor in gather_list]
-
+    output_tensors = [gather_list] if dst == my_rank else []
     input_tensors = [tensor]
     opts = GatherOptions()
     opts.rootRank = dst
     if group is None or group is GroupMember.WORLD:
         default_pg = _get_default_group()
-        if tensor.device.type == 'npu':
-            if my_rank == dst:
-                warnings.warn("HCCL doesn't support gather at the moment. Implemented with allgather instead.")
-            # To handle tensors of different shape on each rank, update recv shape first.
-            dist.broadcast_object_list(recv_size_list, dst, group)
-            if not gather_list:
-                gather_list = [torch.empty(tensor_size, dtype=tensor.dtype).npu() for tensor_size in recv_size_list]
-
-            output_tensors = [gather_list]
-            _group = default_pg._get_backend(torch.device("npu"))
-            work = _group.allgather(output_tensors, input_tensors)
-        else:
-            output_tensors = [gather_list] if dst == my_rank else []
-            default_pg = _get_default_group()
-            work = default_pg.gather(output_tensors, input_tensors, opts)
+        work = default_pg.gather(output_tensors, input_tensors, opts)
     else:
-        if tensor.device.type == 'npu':
-            if my_rank == dst:
-                warnings.warn("HCCL doesn't support gather at the moment. Implemented with allgather instead.")
-            # To handle tensors of different shape on each rank, update recv shape first.
-            dist.broadcast_object_list(recv_size_list, dst, group)
-            if not gather_list:
-                gather_list = [torch.empty(tensor_size, dtype=tensor.dtype).npu() for tensor_size in recv_size_list]
-
-            output_tensors = [gather_list]
-            _group = group._get_backend(torch.device("npu"))
-            work = _group.allgather(output_tensors, input_tensors)
-        else:
-            group_dst_rank = get_group_rank(group, dst)
-            output_tensors = [gather_list] if dst == my_rank else []
-            opts.rootRank = group_dst_rank
-            work = group.gather(output_tensors, input_tensors, opts)
+        group_dst_rank = get_group_rank(group, dst)
+        opts.rootRank = group_dst_rank
+        work = group.gather(output_tensors, input_tensors, opts)
     if async_op:
         return work
     else:
@@ -227,6 +199,35 @@ def reinit_process_group(group=None, rebuild_link=True):
 
 
 
+def init_hccl_comms(groups=None, max_workers=0):
+    """
+    Eagerly creates the HCCL communicators of ``groups`` on the current device,
+    concurrently instead of one by one on the first collective of each group.
+    ``groups`` defaults to every process group this rank belongs to and must
+    list the groups in the same relative order on all ranks. ``max_workers``
+    bounds the number of groups created at once, 0 means no bound.
+
+    Returns a dict mapping each group to its creation time in milliseconds,
+    0.0 for groups whose communicator already existed.
+    """
+    npu_device = torch.device('npu')
+    if groups is None:
+        groups = list(_pg_map.keys())
+    pgs = []
+    backends = []
+    for group in groups:
+        if group is None or group is GroupMember.WORLD:
+            group = _get_default_group()
+        if _rank_not_in_group(group) or npu_device not in group._device_types:
+            continue
+        if group in pgs:
+            continue
+        pgs.append(group)
+        backends.append(group._get_backend(npu_device))
+    latencies = _init_hccl_comms(backends, max_workers)
+    return dict(zip(pgs, latencies))
+
+
 def _reduce_scatter_tensor_uneven(output, input, input_split_sizes=None, op=dist.ReduceOp.SUM, group=None, async_op=False):
     if _rank_not_in_group(group):
         _warn_not_in_group("reduce_scatter_tensor_uneven")
@@ -277,6 +278,39 @@ def _all_gather_into_tensor_uneven(output, input, output_split_sizes=None, group
         return None
 
 
+def _all_to_all_single_device_splits(output, input, output_split_sizes, input_split_sizes,
+                                     exchange_split_sizes=True, group=None, async_op=False):
+    """
+    Like ``all_to_all_single`` with uneven splits, but ``output_split_sizes`` and
+    ``input_split_sizes`` are int64 npu tensors of group size elements, so split
+    sizes computed on device can be passed as they are. With
+    ``exchange_split_sizes``, ``output_split_sizes`` is filled with the input split
+    sizes of the peers instead of being read. ``output`` must be large enough for
+    the received rows. The call waits for the split sizes to reach the host and
+    raises a RuntimeError if they do not fit the tensors.
+    """
+    if _rank_not_in_group(group):
+        _warn_not_in_group("all_to_all_single_device_splits")
+        return None
+
+    if output.device.type != 'npu' or input.device.type != 'npu':
+        warnings.warn("Support for Tensors is limited to those of type npu")
+        return None
+
+    if group is None or group is GroupMember.WORLD:
+        group = _get_default_group()
+    group = group._get_backend(torch.device("npu"))
+
+    work = group.all_to_all_single_device_splits(output, input, output_split_sizes, input_split_sizes,
+                                                 exchange_split_sizes)
+
+    if async_op:
+        return work
+    else:
+        work.wait()
+        return None
+
+
 def _destructor_process_group():
     _update_default_pg(None)
     _world.pg_map.clear()
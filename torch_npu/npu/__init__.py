@@ -20,6 +20,11 @@ __all__ = [
     "default_stream",
     "set_sync_debug_mode",
     "get_sync_debug_mode",
+    "set_op_host_stats_enabled",
+    "is_op_host_stats_enabled",
+    "op_host_stats",
+    "set_op_device_timing_interval",
+    "get_op_device_timing_interval",
     "init_dump",
     "utilization",
     "finalize_dump",
@@ -120,7 +125,8 @@ from .utils import (synchronize, device_count, can_device_access_peer, set_devic
                     device, device_of, stream, set_stream, current_stream, default_stream, set_sync_debug_mode,
                     get_sync_debug_mode, init_dump, current_blas_handle, is_bf16_supported,
                     utilization, finalize_dump, set_dump, get_npu_overflow_flag, clear_npu_overflow_flag, mem_get_info,
-                    check_uce_in_memory, stress_detect)
+                    check_uce_in_memory, stress_detect, set_op_host_stats_enabled, is_op_host_stats_enabled,
+                    op_host_stats, set_op_device_timing_interval, get_op_device_timing_interval)
 from ._recovery import restart_device, stop_device
 from .streams import Stream, Event, SyncLaunchStream
 from .mstx import mstx
@@ -64,6 +64,18 @@ class mstx:
             return
         torch_npu._C._mstx._range_end(range_id)
 
+    @staticmethod
+    @_no_exception_func()
+    def set_domain_enabled(domain: str, enabled: bool = True):
+        """Enables or disables the markers torch_npu emits in a domain, ``default`` for the markers
+        of this module and ``communication`` for the HCCL collectives. Markers of a disabled
+        domain cost a single check, their messages are not built."""
+        if not isinstance(domain, str) or not isinstance(enabled, bool):
+            warnings.warn("Invalid domain or enabled for mstx.set_domain_enabled func. "
+                          "Please input a domain name and a bool.")
+            return
+        torch_npu._C._mstx._set_domain_enable(domain, enabled)
+
     @staticmethod
     @_no_exception_func()
     def mstx_range(message: str, stream=None):
@@ -21,11 +21,21 @@ _option_map = {"ACL_PRECISION_MODE": ["allow_fp32_to_fp16", "must_keep_origin_dt
                "ACL_DEBUG_DIR": None,
                "ACL_OP_COMPILER_CACHE_MODE": ["disable", "enable", "force"],
                "ACL_OP_COMPILER_CACHE_DIR": None,
-               "ACL_OP_DEBUG_OPTION": None}
+               "ACL_OP_DEBUG_OPTION": None,
+               "OP_HOOK_OP_LIST": None,
+               "OP_HOOK_SAMPLE_INTERVAL": (lambda value: value.isdigit() and int(value) >= 1),
+               "OP_HOOK_SAMPLE_RATE": (lambda value: _is_sample_rate(value))}
 
 _deprecated_option_set = {"ACL_OP_SELECT_IMPL_MODE", "ACL_OPTYPELIST_FOR_IMPLMODE"}
 
 
+def _is_sample_rate(value) -> bool:
+    try:
+        return 0 < float(value) <= 1
+    except ValueError:
+        return False
+
+
 def _check_compile_option(name, value) -> bool:
     if name in _option_map.keys():
         if _option_map[name] is None:
@@ -19,7 +19,8 @@ __all__ = ["synchronize", "device_count", "can_device_access_peer", "set_device"
            "stream", "set_stream", "current_stream", "default_stream", "set_sync_debug_mode", "get_sync_debug_mode",
            "init_dump", "set_dump", "finalize_dump", "is_support_inf_nan", "is_bf16_supported",
            "get_npu_overflow_flag", "npu_check_overflow", "clear_npu_overflow_flag", "current_blas_handle",
-           "check_uce_in_memory", "stress_detect"]
+           "check_uce_in_memory", "stress_detect", "set_op_host_stats_enabled", "is_op_host_stats_enabled",
+           "op_host_stats", "set_op_device_timing_interval", "get_op_device_timing_interval"]
 
 
 def synchronize(device=None):
@@ -294,6 +295,65 @@ def get_sync_debug_mode():
     return torch_npu._C._npu_get_sync_debug_mode()
 
 
+def set_op_host_stats_enabled(enabled):
+    r"""Enables or disables the per operator host latency histograms.
+
+    The histograms can also be enabled at startup with ``OP_HOST_STATS_ENABLE=1``.
+    """
+
+    if not isinstance(enabled, bool):
+        raise TypeError("enabled must be a bool, but got {}".format(type(enabled)) + pta_error(ErrCode.TYPE))
+    torch_npu._C._npu_set_op_host_stats_enabled(enabled)
+
+
+def is_op_host_stats_enabled():
+    r"""Returns whether the per operator host latency histograms are recording."""
+
+    return torch_npu._C._npu_is_op_host_stats_enabled()
+
+
+def op_host_stats(reset=False):
+    r"""Returns the host latencies of every operator run since the last reset.
+
+    Each entry holds ``op_name`` and, for the ``build``, ``queue_wait``,
+    ``launch`` and ``device`` phases, the sample count with the total, average,
+    maximum and p50/p90/p99 latencies in microseconds. Percentiles come from a
+    log histogram and are accurate to about 20%. ``device`` is only filled in
+    for the launches timed by :func:`set_op_device_timing_interval`.
+
+    Args:
+        reset (bool, optional): clear the counters as they are read, so that
+            periodic callers get per interval figures. Default: ``False``.
+    """
+
+    if not isinstance(reset, bool):
+        raise TypeError("reset must be a bool, but got {}".format(type(reset)) + pta_error(ErrCode.TYPE))
+    return torch_npu._C._npu_op_host_stats(reset)
+
+
+def set_op_device_timing_interval(interval):
+    r"""Times the device execution of every ``interval``-th task queue launch.
+
+    The task queue thread records a pair of events around the sampled launches
+    and a background thread adds their elapsed time to the ``device`` phase of
+    :func:`op_host_stats`, which has to be enabled as well. Launches are left
+    untimed while too many sampled ones are still running. ``0`` stops timing.
+    The interval can also be set at startup with ``OP_DEVICE_TIMING_INTERVAL``.
+    """
+
+    if not isinstance(interval, int) or isinstance(interval, bool):
+        raise TypeError("interval must be an int, but got {}".format(type(interval)) + pta_error(ErrCode.TYPE))
+    if interval < 0:
+        raise ValueError("interval must not be negative, but got {}".format(interval) + pta_error(ErrCode.VALUE))
+    torch_npu._C._npu_set_op_device_timing_interval(interval)
+
+
+def get_op_device_timing_interval():
+    r"""Returns the interval of the timed task queue launches, 0 if timing is off."""
+
+    return torch_npu._C._npu_get_op_device_timing_interval()
+
+
 def _dummy_type(name):
     def init_err(self):
         class_name = self.__class__.__name__
@@ -215,6 +215,9 @@ class ConfigContext:
         record_op_args = exp_config.get('record_op_args', False)
         export_type = exp_config.get('export_type', 'text')
         msprof_tx = exp_config.get('msprof_tx', False)
+        compress_fwk_data = exp_config.get('compress_fwk_data', False)
+        python_sample_interval_us = exp_config.get('python_sample_interval_us', 0)
+        memory_aggregate_interval_us = exp_config.get('memory_aggregate_interval_us', 0)
 
         self.experimental_config = _ExperimentalConfig(
             profiler_level=profiler_level,
@@ -225,7 +228,10 @@ class ConfigContext:
             data_simplification=data_simplification,
             record_op_args=record_op_args,
             export_type=export_type,
-            msprof_tx=msprof_tx
+            msprof_tx=msprof_tx,
+            compress_fwk_data=compress_fwk_data,
+            python_sample_interval_us=python_sample_interval_us,
+            memory_aggregate_interval_us=memory_aggregate_interval_us
         )
 
     def _parse_exp_cfg(self, json_data: dict):
@@ -37,7 +37,10 @@ class DynamicProfilerShareMemory:
             "data_simplification": True,
             "record_op_args": False,
             "export_type": ["text"],
-            "msprof_tx": False
+            "msprof_tx": False,
+            "compress_fwk_data": False,
+            "python_sample_interval_us": 0,
+            "memory_aggregate_interval_us": 0
         }
     }
 
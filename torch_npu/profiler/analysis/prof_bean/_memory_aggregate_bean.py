@@ -0,0 +1,136 @@
+import struct
+from enum import Enum
+
+from .._profiler_config import ProfilerConfig
+from ..prof_common_func._constant import Constant
+from ..prof_common_func._constant import convert_ns2us_str
+
+__all__ = []
+
+
+class MemoryAggregateEnum(Enum):
+    START_NS = 0
+    END_NS = 1
+    PEAK_NS = 2
+    STREAM_PTR = 3
+    ALLOC_BYTES = 4
+    FREE_BYTES = 5
+    ALLOC_COUNT = 6
+    FREE_COUNT = 7
+    PEAK_ALLOCATED = 8
+    PEAK_RESERVED = 9
+    PEAK_ACTIVE = 10
+    TOTAL_ALLOCATED = 11
+    TOTAL_RESERVED = 12
+    TOTAL_ACTIVE = 13
+    PROCESS_ID = 14
+    DEVICE_TYPE = 15
+    DEVICE_INDEX = 16
+    ALLOCATOR_TYPE = 17
+
+
+class MemoryAggregateBean:
+    """
+    Allocator events of one stream over a time quantum. Stands in for a MemoryUseBean in the memory
+    record timeline, with the totals after the last event of the quantum, or those at its peak.
+    """
+
+    CONSTANT_STRUCT = "<6q2Q6qQ2bB"
+    NPU_ID = 20
+
+    def __init__(self, data, at_peak: bool = False):
+        self._raw_data = data
+        self._constant_data = struct.unpack(self.CONSTANT_STRUCT, data)
+        self._at_peak = at_peak
+
+    def _get(self, end_field: MemoryAggregateEnum, peak_field: MemoryAggregateEnum) -> int:
+        return int(self._constant_data[peak_field.value if self._at_peak else end_field.value])
+
+    @property
+    def time_ns(self) -> int:
+        time_ns = ProfilerConfig().get_timestamp_from_syscnt(
+            self._get(MemoryAggregateEnum.END_NS, MemoryAggregateEnum.PEAK_NS))
+        return ProfilerConfig().get_local_time(time_ns)
+
+    @property
+    def stream_ptr(self) -> int:
+        return int(self._constant_data[MemoryAggregateEnum.STREAM_PTR.value])
+
+    @property
+    def alloc_bytes(self) -> int:
+        return int(self._constant_data[MemoryAggregateEnum.ALLOC_BYTES.value])
+
+    @property
+    def free_bytes(self) -> int:
+        return int(self._constant_data[MemoryAggregateEnum.FREE_BYTES.value])
+
+    @property
+    def alloc_count(self) -> int:
+        return int(self._constant_data[MemoryAggregateEnum.ALLOC_COUNT.value])
+
+    @property
+    def free_count(self) -> int:
+        return int(self._constant_data[MemoryAggregateEnum.FREE_COUNT.value])
+
+    @property
+    def total_allocated(self) -> float:
+        return self.total_allocated_for_db / Constant.B_TO_MB
+
+    @property
+    def total_allocated_for_db(self) -> int:
+        return self._get(MemoryAggregateEnum.TOTAL_ALLOCATED, MemoryAggregateEnum.PEAK_ALLOCATED)
+
+    @property
+    def total_reserved(self) -> float:
+        return self.total_reserved_for_db / Constant.B_TO_MB
+
+    @property
+    def total_reserved_for_db(self) -> int:
+        return self._get(MemoryAggregateEnum.TOTAL_RESERVED, MemoryAggregateEnum.PEAK_RESERVED)
+
+    @property
+    def total_active(self) -> float:
+        return self.total_active_for_db / Constant.B_TO_MB
+
+    @property
+    def total_active_for_db(self) -> int:
+        return self._get(MemoryAggregateEnum.TOTAL_ACTIVE, MemoryAggregateEnum.PEAK_ACTIVE)
+
+    @property
+    def pid(self) -> int:
+        return int(self._constant_data[MemoryAggregateEnum.PROCESS_ID.value])
+
+    @property
+    def device_type(self) -> int:
+        return int(self._constant_data[MemoryAggregateEnum.DEVICE_TYPE.value])
+
+    @property
+    def device_index(self) -> int:
+        return int(self._constant_data[MemoryAggregateEnum.DEVICE_INDEX.value])
+
+    @property
+    def allocator_type(self) -> int:
+        return int(self._constant_data[MemoryAggregateEnum.ALLOCATOR_TYPE.value])
+
+    @property
+    def device_tag(self) -> str:
+        if self.is_npu():
+            return f"NPU:{self.device_index}"
+        else:
+            return f"CPU"
+
+    @property
+    def row(self) -> list:
+        return [Constant.PTA, convert_ns2us_str(self.time_ns, tail="\t"), self.total_allocated,
+                self.total_reserved, self.total_active, self.stream_ptr, self.device_tag]
+
+    def is_npu(self) -> bool:
+        return self.device_type == self.NPU_ID
+
+    def has_peak(self) -> bool:
+        """Whether allocated memory peaked before the last event of the quantum."""
+        return self._constant_data[MemoryAggregateEnum.PEAK_NS.value] < \
+            self._constant_data[MemoryAggregateEnum.END_NS.value]
+
+    def peak_record(self):
+        return MemoryAggregateBean(self._raw_data, at_peak=True)
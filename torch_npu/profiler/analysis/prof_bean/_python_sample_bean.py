@@ -0,0 +1,51 @@
+import struct
+from enum import Enum
+
+__all__ = []
+
+
+class PythonSampleEnum(Enum):
+    THREAD_ID = 0
+    HASH_KEY = 1
+    COUNT = 2
+    NODE_ID = 3
+    PARENT_ID = 4
+    INTERVAL_US = 5
+
+
+class PythonSampleBean:
+
+    CONSTANT_STRUCT = "<3Q3I"
+
+    def __init__(self, data):
+        self._constant_data = struct.unpack(self.CONSTANT_STRUCT, data)
+        self._tid = int(self._constant_data[PythonSampleEnum.THREAD_ID.value])
+        self._key = int(self._constant_data[PythonSampleEnum.HASH_KEY.value])
+        self._count = int(self._constant_data[PythonSampleEnum.COUNT.value])
+        self._node_id = int(self._constant_data[PythonSampleEnum.NODE_ID.value])
+        self._parent_id = int(self._constant_data[PythonSampleEnum.PARENT_ID.value])
+        self._interval_us = int(self._constant_data[PythonSampleEnum.INTERVAL_US.value])
+
+    @property
+    def tid(self) -> int:
+        return self._tid
+
+    @property
+    def key(self) -> int:
+        return self._key
+
+    @property
+    def count(self) -> int:
+        return self._count
+
+    @property
+    def node_id(self) -> int:
+        return self._node_id
+
+    @property
+    def parent_id(self) -> int:
+        return self._parent_id
+
+    @property
+    def interval_us(self) -> int:
+        return self._interval_us
@@ -40,6 +40,13 @@ class Constant(object):
     # gc record struct format
     GC_RECORD_FORMAT = "<3Q"
 
+    # python stack sampler
+    MAX_PYTHON_SAMPLE_INTERVAL_US = 1000 * 1000
+    PYTHON_SAMPLE_STACKS = "python_sample_stacks.txt"
+
+    # aggregated memory records
+    MAX_MEMORY_AGGREGATE_INTERVAL_US = 60 * 1000 * 1000
+
     # field name
     SEQUENCE_NUMBER = "Sequence number"
     FORWARD_THREAD_ID = "Fwd thread id"
@@ -12,3 +12,5 @@ class FileTag(Enum):
     PYTHON_TRACER_FUNC = 7
     PYTHON_TRACER_HASH = 8
     PARAM_TENSOR_INFO = 9
+    PYTHON_SAMPLE = 10
+    MEMORY_AGGREGATE = 11
@@ -0,0 +1,137 @@
+import os
+import struct
+
+from torch_npu.utils._error_code import ErrCode, prof_error
+from ....utils._path_manager import PathManager
+
+try:
+    import lz4.block as _lz4_block
+except ImportError:
+    _lz4_block = None
+
+__all__ = []
+
+
+class SegmentFile:
+    """Reader of the compressed framework data files written with compress_fwk_data.
+
+    The layout is described in torch_npu/csrc/toolkit/profiler/inc/segment_file.h. Each segment
+    holds whole records, so segments can be decompressed and decoded independently.
+    """
+    FILE_MAGIC = 0x5A55504E
+    INDEX_MAGIC = 0x495A504E
+    FILE_HEADER = struct.Struct("<IHH")
+    SEGMENT_HEADER = struct.Struct("<II")
+    INDEX_ENTRY = struct.Struct("<QQII")
+    TRAILER = struct.Struct("<QQII")
+
+    def __init__(self, file_path: str):
+        self._file_path = file_path
+        self._segments = None
+
+    @classmethod
+    def is_segment_file(cls, file_path: str) -> bool:
+        if not os.path.isfile(file_path) or os.path.getsize(file_path) < cls.FILE_HEADER.size:
+            return False
+        with open(file_path, "rb") as file:
+            magic, _, _ = cls.FILE_HEADER.unpack(file.read(cls.FILE_HEADER.size))
+        return magic == cls.FILE_MAGIC
+
+    @classmethod
+    def lz4_block_decompress(cls, src: bytes, raw_size: int) -> bytes:
+        if _lz4_block is not None:
+            return _lz4_block.decompress(src, uncompressed_size=raw_size)
+        dst = bytearray()
+        index, src_len = 0, len(src)
+        while index < src_len:
+            token = src[index]
+            index += 1
+            literal_len = token >> 4
+            if literal_len == 15:
+                while True:
+                    literal_len += src[index]
+                    index += 1
+                    if src[index - 1] != 255:
+                        break
+            dst += src[index: index + literal_len]
+            index += literal_len
+            if index >= src_len:
+                break
+            offset = src[index] | (src[index + 1] << 8)
+            index += 2
+            match_len = token & 0xf
+            if match_len == 15:
+                while True:
+                    match_len += src[index]
+                    index += 1
+                    if src[index - 1] != 255:
+                        break
+            match_len += 4
+            if offset == 0 or offset > len(dst):
+                raise RuntimeError("Invalid lz4 block offset." + prof_error(ErrCode.VALUE))
+            start = len(dst) - offset
+            if offset >= match_len:
+                dst += dst[start: start + match_len]
+            else:
+                # The match overlaps its own output, which repeats the last offset bytes.
+                pattern = dst[start:]
+                dst += (pattern * (match_len // offset + 1))[:match_len]
+        if len(dst) != raw_size:
+            raise RuntimeError("Decompressed size mismatch." + prof_error(ErrCode.VALUE))
+        return bytes(dst)
+
+    def segments(self) -> list:
+        """(file offset, raw offset, compressed size, raw size) of every segment."""
+        if self._segments is None:
+            PathManager.check_file_path_readable(self._file_path)
+            with open(self._file_path, "rb") as file:
+                self._segments = self._read_index(file) or self._scan_segments(file)
+        return self._segments
+
+    def read_segment(self, segment_id: int) -> bytes:
+        offset, _, compressed_size, raw_size = self.segments()[segment_id]
+        with open(self._file_path, "rb") as file:
+            file.seek(offset + self.SEGMENT_HEADER.size)
+            return self._decompress(file.read(compressed_size), raw_size)
+
+    def read_all(self) -> bytes:
+        segments = self.segments()
+        result = bytearray()
+        with open(self._file_path, "rb") as file:
+            for offset, _, compressed_size, raw_size in segments:
+                file.seek(offset + self.SEGMENT_HEADER.size)
+                result += self._decompress(file.read(compressed_size), raw_size)
+        return bytes(result)
+
+    def _decompress(self, payload: bytes, raw_size: int) -> bytes:
+        if len(payload) == raw_size:
+            return payload
+        return self.lz4_block_decompress(payload, raw_size)
+
+    def _read_index(self, file) -> list:
+        file_size = os.fstat(file.fileno()).st_size
+        if file_size < self.FILE_HEADER.size + self.TRAILER.size:
+            return []
+        file.seek(file_size - self.TRAILER.size)
+        index_offset, count, magic, _ = self.TRAILER.unpack(file.read(self.TRAILER.size))
+        if magic != self.INDEX_MAGIC or \
+                index_offset + count * self.INDEX_ENTRY.size + self.TRAILER.size != file_size:
+            return []
+        file.seek(index_offset)
+        index_bytes = file.read(count * self.INDEX_ENTRY.size)
+        return [self.INDEX_ENTRY.unpack_from(index_bytes, i * self.INDEX_ENTRY.size) for i in range(count)]
+
+    def _scan_segments(self, file) -> list:
+        # No index when the process exited without closing the file.
+        segments = []
+        file_size = os.fstat(file.fileno()).st_size
+        offset, raw_offset = self.FILE_HEADER.size, 0
+        while offset + self.SEGMENT_HEADER.size <= file_size:
+            file.seek(offset)
+            compressed_size, raw_size = self.SEGMENT_HEADER.unpack(file.read(self.SEGMENT_HEADER.size))
+            end = offset + self.SEGMENT_HEADER.size + compressed_size
+            if compressed_size == 0 or end > file_size:
+                break
+            segments.append((offset, raw_offset, compressed_size, raw_size))
+            offset, raw_offset = end, raw_offset + raw_size
+        return segments
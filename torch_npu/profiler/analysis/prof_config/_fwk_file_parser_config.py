@@ -6,6 +6,8 @@ from ..prof_bean._gc_record_bean import GCRecordBean
 from ..prof_bean._python_tracer_hash_bean import PythonTracerHashBean
 from ..prof_bean._python_tracer_func_bean import PythonTracerFuncBean
 from ..prof_bean._param_tensor_bean import ParamTensorBean
+from ..prof_bean._python_sample_bean import PythonSampleBean
+from ..prof_bean._memory_aggregate_bean import MemoryAggregateBean
 
 
 __all__ = []
@@ -20,6 +22,8 @@ class FwkFileParserConfig:
         FileTag.PYTHON_TRACER_FUNC: r"torch\.python_tracer_func",
         FileTag.PYTHON_TRACER_HASH: r"torch\.python_tracer_hash",
         FileTag.PARAM_TENSOR_INFO: r"torch\.param_tensor_info",
+        FileTag.PYTHON_SAMPLE: r"torch\.python_sample",
+        FileTag.MEMORY_AGGREGATE: r"^torch\.memory_aggregate",
     }
 
     FILE_BEAN_MAP = {
@@ -30,4 +34,6 @@ class FwkFileParserConfig:
         FileTag.PYTHON_TRACER_FUNC: {"bean": PythonTracerFuncBean, "is_tlv": False, "struct_size": 33},
         FileTag.PYTHON_TRACER_HASH: {"bean": PythonTracerHashBean, "is_tlv": True, "struct_size": 8},
         FileTag.PARAM_TENSOR_INFO: {"bean": ParamTensorBean, "is_tlv": True, "struct_size": 8},
+        FileTag.PYTHON_SAMPLE: {"bean": PythonSampleBean, "is_tlv": False, "struct_size": 36},
+        FileTag.MEMORY_AGGREGATE: {"bean": MemoryAggregateBean, "is_tlv": False, "struct_size": 123},
     }
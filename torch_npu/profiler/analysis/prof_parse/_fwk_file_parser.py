@@ -8,6 +8,7 @@ from ..prof_common_func._constant import Constant, contact_2num
 from ..prof_common_func._file_manager import FileManager
 from ..prof_common_func._file_tag import FileTag
 from ..prof_common_func._path_manager import ProfilerPathManager
+from ..prof_common_func._segment_file import SegmentFile
 from ..prof_common_func._tlv_decoder import TLVDecoder
 from ..prof_common_func._trace_event_manager import TraceEventManager
 from ..prof_common_func._tree_builder import TreeBuilder
@@ -31,7 +32,10 @@ class FwkFileParser:
         file_path = self._file_list.get(file_tag)
         if not file_path:
             return []
-        all_bytes = FileManager.file_read_all(file_path, "rb")
+        if SegmentFile.is_segment_file(file_path):
+            all_bytes = SegmentFile(file_path).read_all()
+        else:
+            all_bytes = FileManager.file_read_all(file_path, "rb")
         file_bean = FwkFileParserConfig.FILE_BEAN_MAP.get(file_tag, {}).get("bean")
         is_tlv = FwkFileParserConfig.FILE_BEAN_MAP.get(file_tag, {}).get("is_tlv")
         struct_size = FwkFileParserConfig.FILE_BEAN_MAP.get(file_tag, {}).get("struct_size")
@@ -189,6 +193,28 @@ class FwkFileParser:
         python_trace_parser = PythonTraceParser(torch_tids, trace_hash_data, func_call_data)
         return python_trace_parser.get_python_trace_data()
 
+    def get_python_sample_stacks(self) -> list:
+        """Folds the sampled python call trees into "thread;outer;...;inner value" lines, the value being the
+        estimated self time in us, the format of export_stacks."""
+        sample_data = self.get_file_data_by_tag(FileTag.PYTHON_SAMPLE)
+        if not sample_data:
+            return []
+        hash_dict = {hash_bean.key: hash_bean.value
+                     for hash_bean in self.get_file_data_by_tag(FileTag.PYTHON_TRACER_HASH)}
+        node_dict = {(node.tid, node.node_id): node for node in sample_data}
+        stacks = []
+        for node in sample_data:
+            if node.count <= 0:
+                continue
+            frames = []
+            current = node
+            while current:
+                frames.append(hash_dict.get(current.key, str(current.key)).replace(";", ","))
+                current = node_dict.get((current.tid, current.parent_id))
+            frames.append(f"thread {node.tid}")
+            stacks.append(";".join(reversed(frames)) + " " + str(node.count * node.interval_us))
+        return sorted(stacks)
+
     @classmethod
     def filter_fwd_bwd_event(cls, fwd_dict: dict, torch_op: TorchOpBean):
         seq_num = torch_op.args.get("Sequence number", -1)
@@ -109,6 +109,7 @@ class MemoryPrepareParser(BaseParser):
                 if record.is_inner_allocator():
                     npu_memory_dict.setdefault(record.pid, []).append(record)
                 self.pta_record_list.append(record)
+        self._add_pta_memory_aggregate_data()
         for torch_op in self._torch_op_node:
             torch_op_dict.setdefault(torch_op.pid, []).append(torch_op)
         for pid_key, memory_records in npu_memory_dict.items():
@@ -131,6 +132,19 @@ class MemoryPrepareParser(BaseParser):
             if Constant.Db in ProfilerConfig().export_type:
                 self.memory_data.setdefault(Constant.Db, self._complete_record_entry_for_db(pid_mem_buf, torch_ops))
 
+    def _add_pta_memory_aggregate_data(self):
+        # Aggregated records carry no block addresses, they only add to the memory record timeline.
+        aggregate_data = FwkFileParser(self._profiler_path).get_file_data_by_tag(FileTag.MEMORY_AGGREGATE)
+        if not aggregate_data:
+            return
+        for record in aggregate_data:
+            if not record.is_npu():
+                continue
+            if record.has_peak():
+                self.pta_record_list.append(record.peak_record())
+            self.pta_record_list.append(record)
+        self.pta_record_list.sort(key=lambda x: x.time_ns)
+
     @staticmethod
     def _get_valid_record_entry(records: list) -> list:
         ret_list = list()
@@ -72,6 +72,15 @@ class TraceViewParser(BaseParser):
             FileManager.append_trace_json_by_path(self._temp_trace_file_path, self._trace_data, self._trace_file_path)
         else:
             FileManager.create_json_file_by_path(self._trace_file_path, self._trace_data)
+        self._generate_python_sample_stacks()
+
+    def _generate_python_sample_stacks(self) -> None:
+        if not os.path.isdir(self._output_path):
+            return
+        stacks = FwkFileParser(self._profiler_path).get_python_sample_stacks()
+        if stacks:
+            FileManager.create_text_file_by_path(os.path.join(self._output_path, Constant.PYTHON_SAMPLE_STACKS),
+                                                 "\n".join(stacks))
 
     def _get_flow_event(self, msprof_timeline_data: list) -> list:
         flow_event_list = []
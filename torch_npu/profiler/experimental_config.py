@@ -64,7 +64,10 @@ class _ExperimentalConfig:
                  record_op_args: bool = False,
                  op_attr: bool = False,
                  gc_detect_threshold: float = None,
-                 export_type: Union[str, list] = None):
+                 export_type: Union[str, list] = None,
+                 compress_fwk_data: bool = False,
+                 python_sample_interval_us: int = 0,
+                 memory_aggregate_interval_us: int = 0):
         self._profiler_level = profiler_level
         self._aic_metrics = aic_metrics
         if self._profiler_level != Constant.LEVEL_NONE:
@@ -77,6 +80,9 @@ class _ExperimentalConfig:
         self._export_type = self._conver_export_type_to_list(export_type)
         self._op_attr = op_attr
         self._gc_detect_threshold = gc_detect_threshold
+        self._compress_fwk_data = compress_fwk_data
+        self._python_sample_interval_us = python_sample_interval_us
+        self._memory_aggregate_interval_us = memory_aggregate_interval_us
         self._check_params()
 
     def __call__(self) -> torch_npu._C._profiler._ExperimentalConfig:
@@ -85,7 +91,10 @@ class _ExperimentalConfig:
                                                           l2_cache=self._l2_cache,
                                                           record_op_args=self.record_op_args,
                                                           msprof_tx=self._msprof_tx,
-                                                          op_attr=self._op_attr)
+                                                          op_attr=self._op_attr,
+                                                          compress_fwk_data=self._compress_fwk_data,
+                                                          python_sample_interval_us=self._python_sample_interval_us,
+                                                          memory_aggregate_interval_us=self._memory_aggregate_interval_us)
 
     @property
     def export_type(self):
@@ -148,6 +157,21 @@ class _ExperimentalConfig:
         if not isinstance(self._op_attr, bool):
             print_warn_msg("Invalid parameter op_attr, which must be of boolean type, reset it to False.")
             self._op_attr = False
+        if not isinstance(self._compress_fwk_data, bool):
+            print_warn_msg("Invalid parameter compress_fwk_data, which must be of boolean type, reset it to False.")
+            self._compress_fwk_data = False
+        if isinstance(self._python_sample_interval_us, bool) or \
+            not isinstance(self._python_sample_interval_us, int) or \
+            not 0 <= self._python_sample_interval_us <= Constant.MAX_PYTHON_SAMPLE_INTERVAL_US:
+            print_warn_msg("Invalid parameter python_sample_interval_us, which must be an integer between 0 and "
+                           f"{Constant.MAX_PYTHON_SAMPLE_INTERVAL_US}, reset it to 0.")
+            self._python_sample_interval_us = 0
+        if isinstance(self._memory_aggregate_interval_us, bool) or \
+            not isinstance(self._memory_aggregate_interval_us, int) or \
+            not 0 <= self._memory_aggregate_interval_us <= Constant.MAX_MEMORY_AGGREGATE_INTERVAL_US:
+            print_warn_msg("Invalid parameter memory_aggregate_interval_us, which must be an integer between 0 and "
+                           f"{Constant.MAX_MEMORY_AGGREGATE_INTERVAL_US}, reset it to 0.")
+            self._memory_aggregate_interval_us = 0
         if not all(export_type in [ExportType.Text, ExportType.Db] for export_type in self._export_type):
             print_warn_msg("Invalid parameter export_type, reset it to text.")
             self._export_type = [ExportType.Text]
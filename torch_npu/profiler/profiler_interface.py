@@ -13,6 +13,7 @@ from torch_npu._C._profiler import (
     _start_profiler,
     _stop_profiler,
     _finalize_profiler,
+    _get_dropped_records,
     _get_syscnt_enable,
     _get_freq,
     _get_syscnt,
@@ -119,6 +120,10 @@ class _ProfInterface:
 
     def stop_trace(self):
         _stop_profiler()
+        dropped_records = _get_dropped_records()
+        if dropped_records > 0:
+            print_warn_msg(f"{dropped_records} framework records were dropped because the profiler buffers were full, "
+                           "the collected data is incomplete.")
         self.stop_gc_detect()
         _disable_event_record()
 
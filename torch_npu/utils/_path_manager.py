@@ -101,6 +101,22 @@ class PathManager:
             msg = f"The path permission check failed: {path}"
             raise RuntimeError(msg + pta_error(ErrCode.PERMISSION))
 
+    @classmethod
+    def check_file_path_readable(cls, path):
+        """
+        Function Description:
+            check whether the file path is valid and readable
+        Parameter:
+            path: the file path to check
+        Exception Description:
+            when invalid data throw exception
+        """
+        cls.check_input_file_path(path)
+        cls.check_path_owner_consistent(path)
+        if not os.access(path, os.R_OK):
+            msg = f"The path permission check failed: {path}"
+            raise RuntimeError(msg + pta_error(ErrCode.PERMISSION))
+
     @classmethod
     def remove_path_safety(cls, path: str):
         msg = f"Failed to remove path: {path}"